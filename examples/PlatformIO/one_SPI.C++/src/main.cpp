@@ -11,6 +11,8 @@ under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
 CONDITIONS OF ANY KIND, either express or implied. See the License for the
 specific language governing permissions and limitations under the License.
 */
+#include <math.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "FatFsSd.h"
@@ -44,6 +46,51 @@ void put_out_debug_message(const char *s) {
         for (;;) __breakpoint();                                 \
     }
 
+// Compare a formatted string with the expected one
+static bool expect(char const *got, char const *want) {
+    if (0 == strcmp(got, want)) return true;
+    cout << "Formatted \"" << got << "\", expected \"" << want << "\"" << endl;
+    return false;
+}
+
+// Check edge cases of the number formatting of the output streams
+static bool check_formatting() {
+    char buf[40];
+    obufstream ob(buf, sizeof buf);
+    bool ok = true;
+
+    // The sign of negative zero, once, with showpos
+    ob.setf(ios::showpos);
+    ob << setprecision(2) << -0.0;
+    ok &= expect(ob.buf(), "-0.00");
+    ob.init(buf, sizeof buf);
+    ob.unsetf(ios::showpos);
+
+    // Too many digits for fmt_fixed, but within the range of the digit loop
+    ob << setprecision(10) << 1e6;
+    ok &= expect(ob.buf(), "1000000.0000000000");
+    return ok;
+}
+
+// File::printf must write the same as snprintf, also for the %f values
+// that it cannot hand to f_printf: infinities, NaN and huge numbers
+static bool check_file_printf() {
+    char const* const format = "%f %f %f %.2f %8.3f %-6.1f|\n";
+    char want[400], got[400];
+    snprintf(want, sizeof want, format, INFINITY, -INFINITY, NAN, 1e300, 2.5, -0.25);
+    FatFsNs::File file;
+    FRESULT fr = file.open("printf.txt", FA_CREATE_ALWAYS | FA_WRITE | FA_READ);
+    if (FR_OK != fr) {
+        cout << "open: " << FRESULT_str(fr) << endl;
+        return false;
+    }
+    bool ok = file.printf(format, INFINITY, -INFINITY, NAN, 1e300, 2.5, -0.25) == (int)strlen(want);
+    ok = ok && FR_OK == file.rewind() && file.gets(got, sizeof got);
+    ok = ok && expect(got, want);
+    file.close();
+    return ok;
+}
+
 void setup() {
     Serial1.begin(115200);  // set up Serial library
     while (!Serial1)
@@ -106,6 +153,10 @@ void setup() {
     /* ********************************************************************** */
     cout << "\033[2J\033[H";  // Clear Screen
     cout << "Hello, world!" << endl;
+    if (!check_formatting()) {
+        cout << "Formatting check failed" << endl;
+        for (;;) __breakpoint();
+    }
     FRESULT fr = card_p->mount();
     CHK_RESULT("mount", fr);
     FatFsNs::File file;
@@ -120,6 +171,10 @@ void setup() {
     }
     fr = file.close();
     CHK_RESULT("close", fr);
+    if (!check_file_printf()) {
+        cout << "File::printf check failed" << endl;
+        for (;;) __breakpoint();
+    }
     fr = card_p->unmount();
     CHK_RESULT("unmount", fr);
 
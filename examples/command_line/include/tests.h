@@ -9,10 +9,16 @@ extern "C" {
     void ls(const char *dir);
     void simple();
     void bench(char const* logdrv);
+    void bench_multicore(char const* logdrv0, char const* logdrv1);
+    void bench_concurrent();
+    void bench_names(char const* logdrv);
+    void bench_fmt(char const* logdrv);
+    void forward_test(char const* logdrv);
     void big_file_test(const char *const pathname, size_t size,
                             uint32_t seed);
     void vCreateAndVerifyExampleFiles(const char *pcMountPath);
     void vStdioWithCWDTest(const char *pcMountPath);
+    void vBenchmarkCharacterIO(const char *pcMountPath);
     bool process_logger();
 #ifdef __cplusplus
 }
@@ -53,6 +53,23 @@ static void card_detect_callback(uint gpio, uint32_t events) {
     card_det_int_pend = true;
 }
 
+// Count free clusters in the background, a few FAT sectors per pass,
+// so that a later f_getfree (e.g., "info") returns without scanning the FAT:
+static void process_getfree() {
+    for (size_t i = 0; i < sd_get_num(); ++i) {
+        sd_card_t *sd_card_p = sd_get_by_num(i);
+        if (!sd_card_p || !sd_card_p->state.mounted)
+            continue;
+        FATFS *fs_p = &sd_card_p->state.fatfs;
+        if (fs_p->free_clst <= fs_p->n_fatent - 2)
+            continue;  // Already known
+        DWORD nclst;
+        BYTE done;
+        f_getfree_step(sd_get_drive_prefix(sd_card_p), &nclst, 4, &done);
+        return;  // One slice per pass
+    }
+}
+
 int main() {
     crash_handler_init();
     stdio_init_all();
@@ -103,6 +120,7 @@ int main() {
         }
         if (card_det_int_pend)
             process_card_detect_int();
+        process_getfree();
         int cRxedChar = getchar_timeout_us(0);
         /* Get the character from terminal */
         if (PICO_ERROR_TIMEOUT != cRxedChar)
@@ -358,6 +358,14 @@ static void run_pwd(const size_t argc, const char *argv[]) {
     else
         printf("%s", buf);
 }
+#if FF_USE_FORWARD
+/* Streaming function for f_forward: writes the file data straight to stdout,
+which is USB CDC or UART depending on the stdio drivers that are enabled */
+static UINT stdout_stream(const BYTE *p, UINT btf) {
+    if (!btf) return 1;  // Sense call: stdio is always ready
+    return fwrite(p, 1, btf, stdout);
+}
+#endif
 static void run_cat(const size_t argc, const char *argv[]) {
     if (!expect_argc(argc, argv, 1)) return;
 
@@ -367,12 +375,26 @@ static void run_cat(const size_t argc, const char *argv[]) {
         printf("f_open error: %s (%d)\n", FRESULT_str(fr), fr);
         return;
     }
+#if FF_USE_FORWARD
+    // Forward the file without copying it through an intermediate buffer
+    while (!f_eof(&fil)) {
+        UINT bf;
+        fr = f_forward(&fil, stdout_stream, 0x8000, &bf);
+        if (FR_OK != fr) {
+            printf("f_forward error: %s (%d)\n", FRESULT_str(fr), fr);
+            break;
+        }
+        if (!bf) break;
+    }
+    fflush(stdout);
+#else
     char buf[256];
     while (f_gets(buf, sizeof buf, &fil)) {
         printf("%s", buf);
     }
     if f_error(&fil)
         printf("f_gets error\n");
+#endif
     fr = f_close(&fil);
     if (FR_OK != fr) printf("f_close error: %s (%d)\n", FRESULT_str(fr), fr);
 }
@@ -451,8 +473,19 @@ static void del_node(const char *path) {
     char buff[256];
     /* Directory to be deleted */
     strlcpy(buff, path, sizeof(buff));
+#if FF_BATCH_FREE
+    /* Free all of the clusters in one pass at the end */
+    FRESULT fr = f_batchfree(path, 1);
+    if (FR_OK == fr) {
+        /* Delete the directory */
+        fr = delete_node(buff, sizeof buff / sizeof buff[0], &fno);
+        FRESULT fr2 = f_batchfree(path, 0);
+        if (FR_OK == fr) fr = fr2;
+    }
+#else
     /* Delete the directory */
     FRESULT fr = delete_node(buff, sizeof buff / sizeof buff[0], &fno);
+#endif
     /* Check the result */
     if (fr) {
         printf("Failed to delete the directory %s. ", path);
@@ -498,6 +531,37 @@ static void run_bench(const size_t argc, const char *argv[]) {
 
     bench(arg);
 }
+static void run_bench_mc(const size_t argc, const char *argv[]) {
+    if (!expect_argc(argc, argv, 2)) return;
+
+    bench_multicore(argv[0], argv[1]);
+}
+static void run_bench_all(const size_t argc, const char *argv[]) {
+    if (!expect_argc(argc, argv, 0)) return;
+
+    bench_concurrent();
+}
+static void run_bench_names(const size_t argc, const char *argv[]) {
+    const char *arg = chk_dflt_log_drv(argc, argv);
+    if (!arg)
+        return;
+
+    bench_names(arg);
+}
+static void run_bench_fmt(const size_t argc, const char *argv[]) {
+    const char *arg = chk_dflt_log_drv(argc, argv);
+    if (!arg)
+        return;
+
+    bench_fmt(arg);
+}
+static void run_forward_test(const size_t argc, const char *argv[]) {
+    const char *arg = chk_dflt_log_drv(argc, argv);
+    if (!arg)
+        return;
+
+    forward_test(arg);
+}
 static void run_cdef(const size_t argc, const char *argv[]) {
     if (!expect_argc(argc, argv, 0)) return;
 
@@ -509,6 +573,11 @@ static void run_swcwdt(const size_t argc, const char *argv[]) {
 
     vStdioWithCWDTest("/cdef");
 }
+static void run_bench_chario(const size_t argc, const char *argv[]) {
+    if (!expect_argc(argc, argv, 0)) return;
+
+    vBenchmarkCharacterIO("/cdef");
+}
 static void run_loop_swcwdt(const size_t argc, const char *argv[]) {
     if (!expect_argc(argc, argv, 0)) return;
 
@@ -541,6 +610,12 @@ static void run_mem_stats(const size_t argc, const char *argv[]) {
     // printf("__StackOneTop - __StackOneBottom = %zu\n", __StackOneTop - __StackOneBottom);
 
     malloc_stats();
+#if FF_MEMPOOL_BLOCKS
+    FF_MEMPOOL_STAT st;
+    ff_mempool_stat(&st);
+    printf("FatFs block pool: %u blocks of %u bytes, %u in use, peak %u, %lu requests served from heap\n",
+           st.blocks, st.size, st.used, st.peak, (unsigned long)st.heap);
+#endif
 }
 
 /* Derived from pico-examples/clocks/hello_48MHz/hello_48MHz.c */
@@ -704,6 +779,28 @@ static cmd_def_t cmds[] = {
      "The SD card will need to be reformatted after this test.\n"
      "\te.g.: lliot 1"},
     {"bench", run_bench, "bench <drive#:>:\n A simple binary write/read benchmark"},
+    {"bench_mc", run_bench_mc,
+     "bench_mc <drive#:> <drive#:>:\n"
+     " Write to two drives at the same time, one from each core,\n"
+     " and report the aggregate throughput. Requires FF_FS_REENTRANT.\n"
+     "\te.g.: bench_mc 0: 1:"},
+    {"bench_all", run_bench_all,
+     "bench_all:\n"
+     " Block level write benchmark on all mounted drives,\n"
+     " one at a time and then concurrently from a single thread.\n"
+     " Reports aggregate MB/s."},
+    {"bench_names", run_bench_names,
+     "bench_names [drive#:]:\n"
+     " Time up-case conversion, lookups and listing of long file names.\n"
+     " Compare builds with different FF_FAST_UNICODE settings."},
+    {"bench_fmt", run_bench_fmt,
+     "bench_fmt [drive#:]:\n"
+     " Time the number formatting core against a digit loop and snprintf,\n"
+     " and f_printf of CSV records to a file."},
+    {"forward_test", run_forward_test,
+     "forward_test [drive#:]:\n"
+     " Check that f_read and f_write carry on correctly after f_forward\n"
+     " stops part way through a sector."},
     {"big_file_test", run_big_file_test,
      "big_file_test <pathname> <size in MiB> <seed>:\n"
      " Writes random data to file <pathname>.\n"
@@ -714,6 +811,11 @@ static cmd_def_t cmds[] = {
     {"cdef", run_cdef,
      "cdef:\n Create Disk and Example Files\n"
      " Expects card to be already formatted and mounted"},
+    {"bench_chario", run_bench_chario,
+     "bench_chario:\n"
+     " Time ff_fputc, ff_fgetc and ff_fgets against one f_write or f_read per byte.\n"
+     " Compare builds with different FF_STDIO_BUF_SIZE settings.\n"
+     " Expects card to be already formatted and mounted"},
     {"swcwdt", run_swcwdt,
      "swcwdt:\n Stdio With CWD Test\n"
      "Expects card to be already formatted and mounted.\n"
@@ -0,0 +1,201 @@
+/* BenchmarkCharacterIO.c
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+/*
+ * Time character at a time and line at a time writes and reads through the
+ * FreeRTOS+FAT compatible API (ff_fputc(), ff_fgetc() and ff_fgets()), and
+ * the same writes and reads with one f_write() or f_read() per byte, as
+ * ff_fputc() and ff_fgetc() do without the FF_FILE buffer
+ * (FF_STDIO_BUF_SIZE in ff_stdio.h).
+ */
+
+#include <stdio.h>
+//
+#include "pico/time.h"
+/* FreeRTOS+FAT headers. */
+#include "ff_stdio.h"
+//
+#include "my_debug.h"
+
+#ifdef NDEBUG
+#   warning "This test relies on asserts to verify test results!"
+#	pragma GCC diagnostic ignored "-Wunused-but-set-variable"
+#endif
+
+#define configASSERT myASSERT
+
+/* The number of bytes written to and read from each file. */
+#define fsBENCH_FILE_SIZE				( 64 * 1024 )
+
+/* The length of the lines, including the newline, written for ff_fgets(). */
+#define fsBENCH_LINE_LENGTH				40
+
+/*
+ * Write and read back a file with ff_fputc() and ff_fgetc().
+ */
+static void prvBenchmark_ff_fputc_ff_fgetc( void );
+
+/*
+ * Write and read back a file with one f_write() and one f_read() per byte.
+ */
+static void prvBenchmark_f_write_f_read( void );
+
+/*
+ * Write a file of lines with ff_fputc() and read it back with ff_fgets().
+ */
+static void prvBenchmark_ff_fgets( void );
+
+static const char *pcFileName = "chario.txt";
+
+/* The byte at a given position of the files. */
+static int prvByteAt( int iPosition )
+{
+	if( ( iPosition % fsBENCH_LINE_LENGTH ) == ( fsBENCH_LINE_LENGTH - 1 ) )
+	{
+		return '\n';
+	}
+	return ( int ) 'a' + ( iPosition % 26 );
+}
+
+static uint64_t prvMicros( void )
+{
+	return to_us_since_boot( get_absolute_time() );
+}
+
+static void prvReport( const char *pcWhat, uint64_t ullMicros )
+{
+	FF_PRINTF( "%-24s %8llu us, %7.1f KiB/s\r\n", pcWhat, ( unsigned long long ) ullMicros,
+			   ( fsBENCH_FILE_SIZE / 1024.0 ) / ( ullMicros / 1000000.0 ) );
+}
+/*-----------------------------------------------------------*/
+
+void vBenchmarkCharacterIO( const char *pcMountPath )
+{
+	int lResult;
+
+	// Pretend mount path:
+	lResult = ff_mkdir( pcMountPath );
+	if( -1 == lResult && errno != EEXIST )
+	{
+		EMSG_PRINTF( "ff_mkdir %s failed: %s (%d)\n", pcMountPath, strerror( errno ), errno );
+		return;
+	}
+	lResult = ff_chdir( pcMountPath );
+	configASSERT( lResult == pdFREERTOS_ERRNO_NONE );
+
+	FF_PRINTF( "FF_STDIO_BUF_SIZE: %d, file size: %d bytes\r\n", FF_STDIO_BUF_SIZE, fsBENCH_FILE_SIZE );
+	prvBenchmark_f_write_f_read();
+	prvBenchmark_ff_fputc_ff_fgetc();
+	prvBenchmark_ff_fgets();
+
+	lResult = ff_remove( pcFileName );
+	configASSERT( lResult == pdFREERTOS_ERRNO_NONE );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmark_ff_fputc_ff_fgetc( void )
+{
+	int iByte, iReturned;
+	FF_FILE *pxFile;
+	uint64_t ullStart;
+
+	ullStart = prvMicros();
+	pxFile = ff_fopen( pcFileName, "w" );
+	configASSERT( pxFile );
+	for( iByte = 0; iByte < fsBENCH_FILE_SIZE; iByte++ )
+	{
+		iReturned = ff_fputc( prvByteAt( iByte ), pxFile );
+		configASSERT( iReturned == prvByteAt( iByte ) );
+	}
+	iReturned = ff_fclose( pxFile );
+	configASSERT( iReturned == pdFREERTOS_ERRNO_NONE );
+	prvReport( "ff_fputc:", prvMicros() - ullStart );
+
+	ullStart = prvMicros();
+	pxFile = ff_fopen( pcFileName, "r" );
+	configASSERT( pxFile );
+	for( iByte = 0; iByte < fsBENCH_FILE_SIZE; iByte++ )
+	{
+		iReturned = ff_fgetc( pxFile );
+		configASSERT( iReturned == prvByteAt( iByte ) );
+	}
+	/* Should not be able to read another byte. */
+	iReturned = ff_fgetc( pxFile );
+	configASSERT( iReturned == FF_EOF );
+	ff_fclose( pxFile );
+	prvReport( "ff_fgetc:", prvMicros() - ullStart );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmark_f_write_f_read( void )
+{
+	int iByte;
+	FIL xFile;
+	FRESULT xResult;
+	UINT uxCount;
+	BYTE ucByte;
+	uint64_t ullStart;
+
+	ullStart = prvMicros();
+	xResult = f_open( &xFile, pcFileName, FA_CREATE_ALWAYS | FA_WRITE );
+	configASSERT( xResult == FR_OK );
+	for( iByte = 0; iByte < fsBENCH_FILE_SIZE; iByte++ )
+	{
+		ucByte = ( BYTE ) prvByteAt( iByte );
+		xResult = f_write( &xFile, &ucByte, 1, &uxCount );
+		configASSERT( xResult == FR_OK && uxCount == 1 );
+	}
+	xResult = f_close( &xFile );
+	configASSERT( xResult == FR_OK );
+	prvReport( "f_write of one byte:", prvMicros() - ullStart );
+
+	ullStart = prvMicros();
+	xResult = f_open( &xFile, pcFileName, FA_READ );
+	configASSERT( xResult == FR_OK );
+	for( iByte = 0; iByte < fsBENCH_FILE_SIZE; iByte++ )
+	{
+		xResult = f_read( &xFile, &ucByte, 1, &uxCount );
+		configASSERT( xResult == FR_OK && uxCount == 1 );
+		configASSERT( ucByte == prvByteAt( iByte ) );
+	}
+	f_close( &xFile );
+	prvReport( "f_read of one byte:", prvMicros() - ullStart );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmark_ff_fgets( void )
+{
+	int iByte, iReturned;
+	FF_FILE *pxFile;
+	char pcLine[ fsBENCH_LINE_LENGTH + 1 ];
+	char *pcReturned;
+	uint64_t ullStart;
+
+	/* The file written by prvBenchmark_ff_fputc_ff_fgetc() is a file of
+	lines. */
+	ullStart = prvMicros();
+	pxFile = ff_fopen( pcFileName, "r" );
+	configASSERT( pxFile );
+	for( iByte = 0; iByte < fsBENCH_FILE_SIZE; )
+	{
+		pcReturned = ff_fgets( pcLine, sizeof( pcLine ), pxFile );
+		configASSERT( pcReturned == pcLine );
+		configASSERT( pcLine[ 0 ] == prvByteAt( iByte ) );
+		iByte += strlen( pcLine );
+	}
+	iReturned = ff_feof( pxFile );
+	configASSERT( iReturned != 0 );
+	ff_fclose( pxFile );
+	prvReport( "ff_fgets:", prvMicros() - ullStart );
+}
@@ -3,12 +3,16 @@
  * This program is a simple binary write/read benchmark.
  */
 #include <my_debug.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+//
+#include "pico/multicore.h"
 
 #include "SDIO/SdioCard.h"
 #include "f_util.h"
 #include "sd_card.h"
+#include "sd_io_service.h"
 #include "hw_config.h"
 
 #define error(s)                       \
@@ -171,7 +175,7 @@ static void bench_open_close(uint8_t* buf) {
     // FA_CREATE_ALWAYS:
     //	Creates a new file.
     //  If the file is existing, it will be truncated and overwritten.
-    FIL file = {};
+    FIL file = {0};
     FRESULT fr = f_open(&file, "bench.dat", FA_READ | FA_WRITE | FA_CREATE_ALWAYS);
     if (FR_OK != fr) {
         EMSG_PRINTF("f_open error: %s (%d)\n", FRESULT_str(fr), fr);
@@ -250,3 +254,194 @@ void bench(char const* logdrv) {
 
     free(buf);
 }
+
+//==============================================================================
+// Two cores writing to two cards at the same time.
+// With FF_FS_REENTRANT, each volume has its own lock,
+// so the cores only contend when they share a bus.
+
+// Size of each core's write buffer
+#define MC_BUF_SIZE 32768
+
+typedef struct mc_job_t {
+    char const *logdrv;
+    uint8_t *buf;
+    uint32_t ms;
+    FRESULT fr;
+    volatile bool done;
+} mc_job_t;
+
+static void mc_write_file(mc_job_t *job_p) {
+    char path[32];
+    snprintf(path, sizeof path, "%s/bench_mc.dat", job_p->logdrv);
+    FIL file = {0};
+    job_p->fr = f_open(&file, path, FA_WRITE | FA_CREATE_ALWAYS);
+    if (FR_OK != job_p->fr) return;
+    job_p->fr = f_expand(&file, FILE_SIZE, 1);
+    if (FR_OK != job_p->fr) {
+        f_close(&file);
+        return;
+    }
+    uint32_t t = millis();
+    for (uint32_t i = 0; i < FILE_SIZE / MC_BUF_SIZE; ++i) {
+        unsigned int bw;
+        job_p->fr = f_write(&file, job_p->buf, MC_BUF_SIZE, &bw);
+        if (FR_OK != job_p->fr) break;
+        if (bw < MC_BUF_SIZE) {
+            job_p->fr = FR_DENIED;  // Disk full
+            break;
+        }
+    }
+    FRESULT fr = f_close(&file);
+    if (FR_OK == job_p->fr) job_p->fr = fr;
+    job_p->ms = millis() - t;
+}
+
+static mc_job_t core1_job;
+
+static void core1_entry() {
+    mc_write_file(&core1_job);
+    core1_job.done = true;
+}
+
+void bench_multicore(char const* logdrv0, char const* logdrv1) {
+#if !FF_FS_REENTRANT
+    EMSG_PRINTF("bench_multicore requires FF_FS_REENTRANT\n");
+    (void)logdrv0;
+    (void)logdrv1;
+#else
+    static_assert(0 == FILE_SIZE % MC_BUF_SIZE, "FILE_SIZE must be a multiple of MC_BUF_SIZE.");
+
+    // Resetting core 1 would kill the I/O service and strand its requests
+    if (sd_io_service_running()) {
+        EMSG_PRINTF("bench_multicore needs core 1, but the I/O service is running there\n");
+        return;
+    }
+    mc_job_t job0 = {.logdrv = logdrv0};
+    core1_job = (mc_job_t){.logdrv = logdrv1};
+    job0.buf = malloc(MC_BUF_SIZE);
+    core1_job.buf = malloc(MC_BUF_SIZE);
+    if (!job0.buf || !core1_job.buf) {
+        EMSG_PRINTF("malloc(%d) failed\n", MC_BUF_SIZE);
+        free(job0.buf);
+        free(core1_job.buf);
+        return;
+    }
+    memset(job0.buf, 'A', MC_BUF_SIZE);
+    memset(core1_job.buf, 'B', MC_BUF_SIZE);
+
+    IMSG_PRINTF("Writing %d MiB to each of %s (core 0) and %s (core 1), please wait.\n",
+                FILE_SIZE_MiB, logdrv0, logdrv1);
+
+    multicore_reset_core1();
+    uint32_t t = millis();
+    multicore_launch_core1(core1_entry);
+    mc_write_file(&job0);
+    while (!core1_job.done) tight_loop_contents();
+    t = millis() - t;
+    multicore_reset_core1();
+
+    mc_job_t const *jobs[] = {&job0, &core1_job};
+    for (size_t i = 0; i < count_of(jobs); ++i) {
+        if (FR_OK != jobs[i]->fr) {
+            EMSG_PRINTF("%s: %s (%d)\n", jobs[i]->logdrv, FRESULT_str(jobs[i]->fr), jobs[i]->fr);
+        } else {
+            IMSG_PRINTF("%s: %.1f KB/s\n", jobs[i]->logdrv, (float)FILE_SIZE / jobs[i]->ms);
+        }
+    }
+    if (FR_OK == job0.fr && FR_OK == core1_job.fr)
+        IMSG_PRINTF("Aggregate: %.1f KB/s\n", 2.0f * FILE_SIZE / t);
+
+    free(job0.buf);
+    free(core1_job.buf);
+#endif
+}
+
+//==============================================================================
+// Block level write throughput across all mounted cards.
+// Each card gets a contiguous, pre-allocated file,
+// and the data is written straight to the file's sectors:
+// first one card at a time, then all cards at once with sd_transfer_concurrent.
+
+// Size of each card's write buffer
+#define CC_BUF_SIZE 16384
+
+// Allocate a contiguous file and return its first sector
+static bool cc_alloc_file(sd_card_t* sd_card_p, uint32_t* first_sector_p) {
+    FATFS* fs_p = &sd_card_p->state.fatfs;
+    char path[32];
+    snprintf(path, sizeof path, "%s/bench_cc.dat", sd_get_drive_prefix(sd_card_p));
+    FIL file = {0};
+    FRESULT fr = f_open(&file, path, FA_WRITE | FA_CREATE_ALWAYS);
+    if (FR_OK != fr) {
+        EMSG_PRINTF("f_open(%s) error: %s (%d)\n", path, FRESULT_str(fr), fr);
+        return false;
+    }
+    fr = f_expand(&file, FILE_SIZE, 1);
+    if (FR_OK == fr) *first_sector_p = fs_p->database + (LBA_t)fs_p->csize * (file.obj.sclust - 2);
+    FRESULT fr2 = f_close(&file);
+    if (FR_OK == fr) fr = fr2;
+    if (FR_OK != fr) {
+        EMSG_PRINTF("%s: %s (%d)\n", path, FRESULT_str(fr), fr);
+        return false;
+    }
+    return true;
+}
+
+// Write FILE_SIZE bytes to each of the n cards. Returns elapsed ms, or 0 on error.
+static uint32_t cc_write(sd_xfer_t xfers[], uint32_t const first_sectors[], size_t n) {
+    uint32_t t = millis();
+    for (uint32_t c = 0; c < FILE_SIZE / CC_BUF_SIZE; ++c) {
+        for (size_t i = 0; i < n; ++i) xfers[i].sector = first_sectors[i] + c * xfers[i].count;
+        block_dev_err_t rc = sd_transfer_concurrent(xfers, n);
+        if (SD_BLOCK_DEVICE_ERROR_NONE != rc) {
+            EMSG_PRINTF("sd_transfer_concurrent error: 0x%x\n", rc);
+            return 0;
+        }
+    }
+    for (size_t i = 0; i < n; ++i) xfers[i].sd_card_p->sync(xfers[i].sd_card_p);
+    return millis() - t;
+}
+
+void bench_concurrent() {
+    static_assert(0 == FILE_SIZE % CC_BUF_SIZE, "FILE_SIZE must be a multiple of CC_BUF_SIZE.");
+
+    sd_xfer_t xfers[FF_VOLUMES] = {0};
+    uint32_t first_sectors[FF_VOLUMES];
+    size_t n = 0;
+    for (size_t i = 0; i < sd_get_num() && n < count_of(xfers); ++i) {
+        sd_card_t* sd_card_p = sd_get_by_num(i);
+        if (!sd_card_p || !sd_card_p->state.mounted) continue;
+        if (!cc_alloc_file(sd_card_p, &first_sectors[n])) continue;
+        xfers[n].sd_card_p = sd_card_p;
+        xfers[n].write = true;
+        xfers[n].count = CC_BUF_SIZE / sd_block_size;
+        xfers[n].buffer = malloc(CC_BUF_SIZE);
+        if (!xfers[n].buffer) {
+            EMSG_PRINTF("malloc(%d) failed\n", CC_BUF_SIZE);
+            break;
+        }
+        memset(xfers[n].buffer, 'A' + n, CC_BUF_SIZE);
+        ++n;
+    }
+    if (!n) {
+        EMSG_PRINTF("No mounted drives\n");
+        return;
+    }
+    IMSG_PRINTF("Writing %d MiB to each of %zu drives, please wait.\n", FILE_SIZE_MiB, n);
+
+    uint32_t total_ms = 0;
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t ms = cc_write(&xfers[i], &first_sectors[i], 1);
+        if (!ms) goto out;
+        IMSG_PRINTF("%s alone: %.2f MB/s\n", sd_get_drive_prefix(xfers[i].sd_card_p),
+                    (float)FILE_SIZE / ms / 1000);
+        total_ms += ms;
+    }
+    IMSG_PRINTF("One at a time, aggregate: %.2f MB/s\n", (float)n * FILE_SIZE / total_ms / 1000);
+
+    uint32_t ms = cc_write(xfers, first_sectors, n);
+    if (ms) IMSG_PRINTF("Concurrent, aggregate: %.2f MB/s\n", (float)n * FILE_SIZE / ms / 1000);
+out:
+    for (size_t i = 0; i < n; ++i) free(xfers[i].buffer);
+}
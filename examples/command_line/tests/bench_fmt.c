@@ -0,0 +1,120 @@
+/* bench_fmt.c
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+/* Number formatting benchmark.
+
+Times the conversions of the number formatting core (fmt_number.h) against
+the digit-at-a-time loop that f_printf used before and against snprintf,
+and then the formatting of CSV records to a file with f_printf.
+*/
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+//
+#include "pico/time.h"
+//
+#include "f_util.h"
+#include "fmt_number.h"
+#include "my_debug.h"
+
+#define N_VALUES 256
+#define N_PASSES 40
+
+#define FILE_NAME "bench_fmt.csv"
+#define N_RECORDS 2000
+
+static uint32_t u32s[N_VALUES];
+static double doubles[N_VALUES];
+
+/* The integer conversion in f_printf before fmt_number */
+static char *digit_loop(char *first, uint32_t v) {
+    char str[10];
+    int i = 0;
+    do {
+        str[i++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+    while (i) *first++ = str[--i];
+    return first;
+}
+
+static double ns_per(uint64_t us, unsigned n) { return us * 1000.0 / n; }
+
+void bench_fmt(char const *logdrv) {
+    srand(1);
+    for (size_t i = 0; i < N_VALUES; ++i) {
+        uint32_t r = (uint32_t)rand() << 16 ^ (uint32_t)rand();
+        u32s[i] = r >> (i % 32);
+        doubles[i] = (int32_t)r / 1000.0;
+    }
+    char buf[32];
+    volatile char sink = 0;
+    unsigned n = N_VALUES * N_PASSES;
+
+    uint64_t t = to_us_since_boot(get_absolute_time());
+    for (unsigned pass = 0; pass < N_PASSES; ++pass)
+        for (size_t i = 0; i < N_VALUES; ++i) sink += *(fmt_u32(buf, buf + sizeof buf, u32s[i]) - 1);
+    uint64_t t_fmt = to_us_since_boot(get_absolute_time()) - t;
+    t = to_us_since_boot(get_absolute_time());
+    for (unsigned pass = 0; pass < N_PASSES; ++pass)
+        for (size_t i = 0; i < N_VALUES; ++i) sink += *(digit_loop(buf, u32s[i]) - 1);
+    uint64_t t_loop = to_us_since_boot(get_absolute_time()) - t;
+    t = to_us_since_boot(get_absolute_time());
+    for (unsigned pass = 0; pass < N_PASSES; ++pass)
+        for (size_t i = 0; i < N_VALUES; ++i) sink += snprintf(buf, sizeof buf, "%" PRIu32, u32s[i]);
+    uint64_t t_snprintf = to_us_since_boot(get_absolute_time()) - t;
+    IMSG_PRINTF("uint32_t: fmt_u32 %.0f ns, digit loop %.0f ns, snprintf %.0f ns\n",
+                ns_per(t_fmt, n), ns_per(t_loop, n), ns_per(t_snprintf, n));
+
+    t = to_us_since_boot(get_absolute_time());
+    for (unsigned pass = 0; pass < N_PASSES; ++pass)
+        for (size_t i = 0; i < N_VALUES; ++i) sink += *(fmt_fixed(buf, buf + sizeof buf, doubles[i], 3) - 1);
+    t_fmt = to_us_since_boot(get_absolute_time()) - t;
+    t = to_us_since_boot(get_absolute_time());
+    for (unsigned pass = 0; pass < N_PASSES; ++pass)
+        for (size_t i = 0; i < N_VALUES; ++i) sink += snprintf(buf, sizeof buf, "%.3f", doubles[i]);
+    t_snprintf = to_us_since_boot(get_absolute_time()) - t;
+    IMSG_PRINTF("double (3 decimals): fmt_fixed %.0f ns, snprintf %.0f ns\n",
+                ns_per(t_fmt, n), ns_per(t_snprintf, n));
+
+    // f_printf of CSV records
+    FRESULT fr = f_chdrive(logdrv);
+    if (FR_OK != fr) {
+        EMSG_PRINTF("f_chdrive error: %s (%d)\n", FRESULT_str(fr), fr);
+        return;
+    }
+    FIL fil;
+    fr = f_open(&fil, FILE_NAME, FA_CREATE_ALWAYS | FA_WRITE);
+    if (FR_OK != fr) {
+        EMSG_PRINTF("f_open error: %s (%d)\n", FRESULT_str(fr), fr);
+        return;
+    }
+    t = to_us_since_boot(get_absolute_time());
+    for (unsigned i = 0; i < N_RECORDS; ++i) {
+        if (f_printf(&fil, "%u,%lu,%.3f\n", i, (unsigned long)u32s[i % N_VALUES],
+                     doubles[i % N_VALUES]) < 0) {
+            EMSG_PRINTF("f_printf failed\n");
+            break;
+        }
+    }
+    t = to_us_since_boot(get_absolute_time()) - t;
+    FSIZE_t size = f_size(&fil);
+    fr = f_close(&fil);
+    if (FR_OK != fr) EMSG_PRINTF("f_close error: %s (%d)\n", FRESULT_str(fr), fr);
+    IMSG_PRINTF("f_printf: %u records (%llu bytes) in %.1f ms, %.1f us/record\n", N_RECORDS,
+                (unsigned long long)size, t / 1000.0, (double)t / N_RECORDS);
+    f_unlink(FILE_NAME);
+}
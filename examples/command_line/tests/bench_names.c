@@ -0,0 +1,139 @@
+/* bench_names.c
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+/* Long file name benchmark.
+
+Times the Unicode up-case conversion and the name lookups and directory
+listing of a directory of realistic long file names. Build with different
+values of FF_FAST_UNICODE (see ffconf.h) to compare them.
+*/
+
+#include <stdio.h>
+#include <string.h>
+//
+#include "pico/time.h"
+//
+#include "f_util.h"
+#include "my_debug.h"
+
+#define DIR_NAME "bench_names"
+
+// Number of files of each kind of name
+#define N_FILES 64
+
+// Up-case conversion passes over the sample text
+#define N_PASSES 1000
+
+/* Mixed sample of the characters found in file names */
+static const WCHAR sample[] =
+    u"2026-10-19_123456_Sensor_Temperature.csv Messwerte_Küche_Größe.txt "
+    u"Датчик_температуры.log Μετρήσεις_θερμοκρασίας.dat";
+
+/* Each kind of name is created with the first format and looked up with the
+second, which differs in case */
+static const char *const formats[][2] = {
+    {"2026-10-%02u_%06u_Sensor_Temperature.csv", "2026-10-%02u_%06u_SENSOR_temperature.CSV"},
+    {"Messwerte_Küche_Größe_%02u_%06u.txt", "MESSWERTE_KÜCHE_GRÖßE_%02u_%06u.TXT"},
+    {"Датчик_температуры_%02u_%06u.log", "ДАТЧИК_ТЕМПЕРАТУРЫ_%02u_%06u.LOG"},
+};
+
+static void make_name(char *buf, size_t size, unsigned k, unsigned c, unsigned i) {
+    snprintf(buf, size, "%s/", DIR_NAME);
+    size_t n = strlen(buf);
+    snprintf(buf + n, size - n, formats[k][c], i % 28 + 1, i * 7919);
+}
+
+void bench_names(char const *logdrv) {
+    FRESULT fr = f_chdrive(logdrv);
+    if (FR_OK != fr) {
+        EMSG_PRINTF("f_chdrive error: %s (%d)\n", FRESULT_str(fr), fr);
+        return;
+    }
+    IMSG_PRINTF("FF_FAST_UNICODE = %d\n", FF_FAST_UNICODE);
+
+    // Up-case conversion alone
+    size_t n_chars = sizeof sample / sizeof sample[0] - 1;
+    DWORD sum = 0;
+    uint64_t t = to_us_since_boot(get_absolute_time());
+    for (unsigned pass = 0; pass < N_PASSES; ++pass)
+        for (size_t i = 0; i < n_chars; ++i) sum += ff_wtoupper(sample[i]);
+    t = to_us_since_boot(get_absolute_time()) - t;
+    IMSG_PRINTF("ff_wtoupper: %.1f ns/char (checksum %lu)\n",
+                t * 1000.0 / (N_PASSES * n_chars), (unsigned long)sum);
+
+    // Populate the directory
+    fr = f_mkdir(DIR_NAME);
+    if (FR_OK != fr) {
+        EMSG_PRINTF("f_mkdir error: %s (%d)\n", FRESULT_str(fr), fr);
+        return;
+    }
+    char name[FF_LFN_BUF];
+    size_t n_kinds = sizeof formats / sizeof formats[0];
+    for (unsigned k = 0; k < n_kinds && FR_OK == fr; ++k) {
+        for (unsigned i = 0; i < N_FILES && FR_OK == fr; ++i) {
+            FIL fil;
+            make_name(name, sizeof name, k, 0, i);
+            fr = f_open(&fil, name, FA_CREATE_NEW | FA_WRITE);
+            if (FR_OK == fr) fr = f_close(&fil);
+        }
+    }
+    if (FR_OK != fr) {
+        EMSG_PRINTF("f_open(%s) error: %s (%d)\n", name, FRESULT_str(fr), fr);
+    }
+
+    // Look up each name with different case
+    for (unsigned k = 0; k < n_kinds && FR_OK == fr; ++k) {
+        t = to_us_since_boot(get_absolute_time());
+        for (unsigned i = 0; i < N_FILES && FR_OK == fr; ++i) {
+            FILINFO fno;
+            make_name(name, sizeof name, k, 1, i);
+            fr = f_stat(name, &fno);
+        }
+        t = to_us_since_boot(get_absolute_time()) - t;
+        if (FR_OK != fr) {
+            EMSG_PRINTF("f_stat(%s) error: %s (%d)\n", name, FRESULT_str(fr), fr);
+            break;
+        }
+        IMSG_PRINTF("f_stat \"%s\": %.1f us/lookup\n", formats[k][1], (double)t / N_FILES);
+    }
+
+    // List the directory
+    if (FR_OK == fr) {
+        DIR dir;
+        FILINFO fno;
+        unsigned n_entries = 0;
+        t = to_us_since_boot(get_absolute_time());
+        fr = f_opendir(&dir, DIR_NAME);
+        while (FR_OK == fr) {
+            fr = f_readdir(&dir, &fno);
+            if (FR_OK != fr || !fno.fname[0]) break;
+            ++n_entries;
+        }
+        f_closedir(&dir);
+        t = to_us_since_boot(get_absolute_time()) - t;
+        if (FR_OK != fr) {
+            EMSG_PRINTF("f_readdir error: %s (%d)\n", FRESULT_str(fr), fr);
+        } else if (n_entries) {
+            IMSG_PRINTF("f_readdir: %.1f us/entry\n", (double)t / n_entries);
+        }
+    }
+
+    // Clean up
+    FILINFO fno;
+    snprintf(name, sizeof name, "%s", DIR_NAME);
+    fr = delete_node(name, sizeof name, &fno);
+    if (FR_OK != fr) {
+        EMSG_PRINTF("delete_node error: %s (%d)\n", FRESULT_str(fr), fr);
+    }
+}
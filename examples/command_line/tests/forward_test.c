@@ -0,0 +1,126 @@
+/* forward_test.c
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+/* f_forward regression test.
+
+Forwards part of a file to a sink that goes busy after a given number of
+bytes, so that f_forward stops in the middle of a sector (with
+FF_FORWARD_SECTORS, in the middle of a span), and checks that f_read and
+f_write carry on from there with the right data. One pass starts with a dirty
+sector in the file's sector buffer.
+*/
+
+#include <stdbool.h>
+#include <string.h>
+//
+#include "f_util.h"
+#include "my_debug.h"
+
+#define FILE_NAME "forward_test.dat"
+#define FILE_SIZE 16384
+#define START 512
+
+static BYTE expect[FILE_SIZE];
+static BYTE got[FILE_SIZE];
+static UINT taken, limit;
+
+static BYTE pattern(UINT i) { return (BYTE)(i * 31 + (i >> 9)); }
+
+/* Streaming function that takes up to limit bytes and then reports busy */
+static UINT sink(const BYTE *p, UINT n) {
+    if (!n) return taken < limit;  // Sense call
+    if (n > limit - taken) n = limit - taken;
+    memcpy(got + taken, p, n);
+    taken += n;
+    return n;
+}
+
+/* On failure, goes to the fail label of the caller, which closes the file */
+#define CHK_FR(x)                                                         \
+    do {                                                                  \
+        FRESULT fr_ = (x);                                                \
+        if (FR_OK != fr_) {                                               \
+            EMSG_PRINTF("%s: %s (%d)\n", #x, FRESULT_str(fr_), fr_);      \
+            goto fail;                                                    \
+        }                                                                 \
+    } while (0)
+
+static bool one_pass(FIL *fil, UINT lim, bool dirty) {
+    UINT n;
+    BYTE buf[100];
+    CHK_FR(f_open(fil, FILE_NAME, FA_READ | FA_WRITE));
+    CHK_FR(f_read(fil, buf, 10, &n));  // Load sector 0 into the sector buffer
+    if (dirty) {
+        CHK_FR(f_lseek(fil, 3));
+        CHK_FR(f_write(fil, "XY", 2, &n));
+        memcpy(expect + 3, "XY", 2);
+    }
+    CHK_FR(f_lseek(fil, START));
+    taken = 0;
+    limit = lim;
+    CHK_FR(f_forward(fil, sink, FILE_SIZE, &n));
+    if (n != lim || f_tell(fil) != START + lim || memcmp(got, expect + START, lim)) {
+        EMSG_PRINTF("f_forward of %u bytes: forwarded %u, position %llu\n", lim, n,
+                    (unsigned long long)f_tell(fil));
+        goto fail;
+    }
+    CHK_FR(f_read(fil, buf, sizeof buf, &n));
+    if (n != sizeof buf || memcmp(buf, expect + START + lim, sizeof buf)) {
+        EMSG_PRINTF("f_read after f_forward of %u bytes returned the wrong data\n", lim);
+        goto fail;
+    }
+    CHK_FR(f_write(fil, "Q", 1, &n));
+    expect[START + lim + sizeof buf] = 'Q';
+    CHK_FR(f_close(fil));
+
+    CHK_FR(f_open(fil, FILE_NAME, FA_READ));
+    CHK_FR(f_read(fil, got, FILE_SIZE, &n));
+    CHK_FR(f_close(fil));
+    if (n != FILE_SIZE || memcmp(got, expect, FILE_SIZE)) {
+        EMSG_PRINTF("File contents wrong after f_forward of %u bytes\n", lim);
+        return false;
+    }
+    return true;
+
+fail:
+    f_close(fil);  // Harmless if the file is not open
+    return false;
+}
+
+void forward_test(char const *logdrv) {
+    FRESULT fr = f_chdrive(logdrv);
+    if (FR_OK != fr) {
+        EMSG_PRINTF("f_chdrive error: %s (%d)\n", FRESULT_str(fr), fr);
+        return;
+    }
+    FIL fil;
+    UINT n;
+    for (UINT i = 0; i < FILE_SIZE; ++i) expect[i] = pattern(i);
+    fr = f_open(&fil, FILE_NAME, FA_CREATE_ALWAYS | FA_WRITE);
+    if (FR_OK == fr) fr = f_write(&fil, expect, FILE_SIZE, &n);
+    if (FR_OK == fr) fr = f_close(&fil);
+    if (FR_OK != fr) {
+        EMSG_PRINTF("Writing %s: %s (%d)\n", FILE_NAME, FRESULT_str(fr), fr);
+        f_close(&fil);
+        return;
+    }
+    bool ok = true;
+    for (int dirty = 0; ok && dirty < 2; ++dirty)
+        for (UINT lim = 1; ok && lim < 5000; lim += 37)
+            ok = one_pass(&fil, lim, dirty);
+    f_unlink(FILE_NAME);
+    IMSG_PRINTF("forward_test: %s\n", ok ? "passed" : "FAILED");
+}
+
+/* [] END OF FILE */
@@ -60,13 +60,10 @@ static void buffered() {
         perror("fopen");
         stop();
     }
-    /* setvbuf() is optional, but alignment is critical for good
-    performance with SDIO because it uses DMA with word width.
-    Also, the buffer size should be a multiple of the SD block 
-    size, 512 bytes. */
-    static char vbuf[1024] __attribute__((aligned));
-    int err = setvbuf(file_p, vbuf, _IOFBF, sizeof vbuf);
-    assert(!err);
+    /* open_file_stream() gives the stream a word aligned buffer of whole
+    SD blocks (see FILE_STREAM_BUF_SIZE in file_stream.h), so there is
+    no need for setvbuf(). Alignment is critical for good performance
+    with SDIO because it uses DMA with word width. */
 
     for (size_t i = 0; i < ITERATIONS; ++i) {
         uint64_t now = micros();
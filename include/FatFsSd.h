@@ -48,6 +48,11 @@ class SdCard {
     static FRESULT getfree(const TCHAR* path, DWORD* nclst, FATFS** fatfs) { /* Get number of free clusters on the drive */
         return f_getfree(path, nclst, fatfs);
     }
+    /* Count free clusters a few FAT sectors at a time.
+    *nclst is a lower bound until *done is set. */
+    static FRESULT getfree_step(const TCHAR* path, DWORD* nclst, UINT nsect, BYTE* done) {
+        return f_getfree_step(path, nclst, nsect, done);
+    }
     static FRESULT getlabel(const TCHAR* path, TCHAR* label, DWORD* vsn) { /* Get volume label */
         return f_getlabel(path, label, vsn);
     }
@@ -127,6 +132,7 @@ class FatFs {
 
 class File {
     FIL fil;
+    friend class LineReader;
 
    public:
     ~File() {
@@ -163,7 +169,11 @@ class File {
     int puts(const TCHAR* str) { /* Put a string to the file */
         return f_puts(str, &fil);
     }
-    int printf(const TCHAR* str, ...);  /* Put a formatted string to the file. Returns -1 on error. */
+    /* Put a formatted string to the file. Returns -1 on error.
+    Formats with f_printf, in place in the file's sector buffer, when it
+    handles every conversion in str the way vsnprintf does, and with
+    vsnprintf otherwise. */
+    int printf(const TCHAR* str, ...);
     TCHAR* gets(TCHAR* buff, int len) { /* Get a string from the file */
         return f_gets(buff, len, &fil);
     }
@@ -188,6 +198,34 @@ class File {
     FRESULT expand(FSIZE_t fsz, BYTE opt) { /* Allocate a contiguous block to the file */
         return f_expand(&fil, fsz, opt);
     }
+#if FF_PREALLOC_CLUSTERS
+    /* Reserve ncl contiguous clusters at a time as the file grows (0 disables) */
+    FRESULT prealloc(DWORD ncl) {
+        return f_prealloc(&fil, ncl);
+    }
+#endif
+};
+
+/* Block-buffered line and field reader for an open File (see line_reader.h).
+getline returns a null terminated line in buf, valid until the next call,
+or NULL at the end of the file or on error. */
+class LineReader {
+    line_reader_t lr;
+
+   public:
+    LineReader(File& file, void* buf, size_t size) {
+        line_reader_init(&lr, &file.fil, buf, size);
+    }
+    char* getline(size_t* len = NULL, char delim = '\n') {
+        return line_reader_getline(&lr, delim, len);
+    }
+    FRESULT error() const { /* Result of the last read */
+        return lr.fr;
+    }
+    /* Split a line into fields in place; see line_split */
+    static size_t split(char* line, size_t len, char delim, char* fields[], size_t max) {
+        return line_split(line, len, delim, fields, max);
+    }
 };
 
 class Dir {
@@ -17,6 +17,7 @@ specific language governing permissions and limitations under the License.
 //
 #include "../src/ff15/source/diskio.h" /* Declarations of disk functions */
 #include "../src/include/f_util.h"
+#include "../src/include/line_reader.h"
 #include "../src/include/my_rtc.h"
 #include "../src/sd_driver/sd_card.h"
 #include "../src/sd_driver/SDIO/rp2040_sdio.h"
@@ -29,6 +29,7 @@
  * \brief FsBaseFile include file.
  */
 #include "FsNew.h"
+#include "../common/FmtNumber.h"
 #include "FatLib/FatLib.h"
 #include "ExFatLib/ExFatLib.h"
 /**
@@ -548,8 +549,16 @@ class FsBaseFile {
    * \return The number of bytes written or -1 if an error occurs.
    */
   size_t printField(double value, char term, uint8_t prec = 2) {
-    return m_fFile ? m_fFile->printField(value, term, prec) :
-           m_xFile ? m_xFile->printField(value, term, prec) : 0;
+    char buf[24];
+    char* str = buf + sizeof(buf);
+    if (term) {
+      *--str = term;
+      if (term == '\n') {
+        *--str = '\r';
+      }
+    }
+    str = fmtDouble(str, value, prec, false);
+    return write(str, buf + sizeof(buf) - str);
   }
   /** Print a number followed by a field terminator.
    * \param[in] value The number to be printed.
@@ -567,8 +576,20 @@ class FsBaseFile {
    */
   template<typename Type>
   size_t printField(Type value, char term) {
-    return m_fFile ? m_fFile->printField(value, term) :
-           m_xFile ? m_xFile->printField(value, term) : 0;
+    char buf[24];
+    char* str = buf + sizeof(buf);
+    if (term) {
+      *--str = term;
+      if (term == '\n') {
+        *--str = '\r';
+      }
+    }
+    if (Type(-1) < Type(0)) {
+      str = fmtSigned(str, static_cast<int64_t>(value));
+    } else {
+      str = fmtBase10(str, static_cast<uint64_t>(value));
+    }
+    return write(str, buf + sizeof(buf) - str);
   }
   /** Print a file's size.
    *
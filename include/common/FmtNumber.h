@@ -0,0 +1,77 @@
+/* FmtNumber.h
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+/* SdFat number formatting interface, implemented on the number to text
+conversion core in fmt_number.h.
+
+As in SdFat, each function writes the text so that it ends just before `str`
+and returns a pointer to its first character. Nothing is allocated and no
+terminating null is written.
+*/
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+//
+#include "fmt_number.h"
+
+inline char* fmtBase10(char* str, uint32_t n) {
+    unsigned len = fmt_len_u32(n);
+    fmt_u32(str - len, str, n);
+    return str - len;
+}
+inline char* fmtBase10(char* str, uint16_t n) {
+    return fmtBase10(str, static_cast<uint32_t>(n));
+}
+inline char* fmtBase10(char* str, uint64_t n) {
+    unsigned len = fmt_len_u64(n);
+    fmt_u64(str - len, str, n);
+    return str - len;
+}
+inline char* fmtSigned(char* str, int64_t n) {
+    bool neg = n < 0;
+    str = fmtBase10(str, neg ? 0 - static_cast<uint64_t>(n) : static_cast<uint64_t>(n));
+    if (neg) *--str = '-';
+    return str;
+}
+inline char* fmtHex(char* str, uint32_t n) {
+    do {
+        uint8_t h = n & 0XF;
+        *--str = h + (h < 10 ? '0' : 'A' - 10);
+        n >>= 4;
+    } while (n);
+    return str;
+}
+/* Needs up to 22 characters before `str` ("nan", "inf" or "ovf" when the
+value is out of the range of fmt_fixed) */
+inline char* fmtDouble(char* str, double d, uint8_t prec, bool altSep) {
+    char tmp[40];
+    char* end = fmt_fixed(tmp, tmp + sizeof(tmp), d, prec);
+    if (!end) {
+        const char* err = isnan(d) ? "nan" : isinf(d) ? "inf" : "ovf";
+        size_t len = strlen(err);
+        return static_cast<char*>(memcpy(str - len, err, len));
+    }
+    if (altSep && prec) tmp[end - tmp - prec - 1] = ',';
+    str -= end - tmp;
+    memcpy(str, tmp, end - tmp);
+    return str;
+}
+inline char* fmtDouble(char* str, float f, uint8_t prec, bool altSep) {
+    return fmtDouble(str, static_cast<double>(f), prec, altSep);
+}
+
+/* [] END OF FILE */
@@ -25,7 +25,7 @@
 #include "StdioStream.h"
 #include "../common/FmtNumber.h"
 //------------------------------------------------------------------------------
-int StdioStream::fclose() {
+int StdioStreamBase::fclose() {
   int rtn = 0;
   if (!m_status) {
     return EOF;
@@ -44,7 +44,7 @@ int StdioStream::fclose() {
   return rtn;
 }
 //------------------------------------------------------------------------------
-int StdioStream::fflush() {
+int StdioStreamBase::fflush() {
   if ((m_status & (S_SWR | S_SRW)) && !(m_status & S_SRD)) {
     if (flushBuf() && StreamBaseFile::sync()) {
       return 0;
@@ -53,7 +53,7 @@ int StdioStream::fflush() {
   return EOF;
 }
 //------------------------------------------------------------------------------
-char* StdioStream::fgets(char* str, size_t num, size_t* len) {
+char* StdioStreamBase::fgets(char* str, size_t num, size_t* len) {
   char* s = str;
   size_t n;
   if (num-- == 0) {
@@ -94,7 +94,7 @@ char* StdioStream::fgets(char* str, size_t num, size_t* len) {
   return str;
 }
 //------------------------------------------------------------------------------
-bool StdioStream::fopen(const char* path, const char* mode) {
+bool StdioStreamBase::fopen(const char* path, const char* mode) {
   oflag_t oflag;
   uint8_t m;
   switch (*mode++) {
@@ -151,12 +151,12 @@ bool StdioStream::fopen(const char* path, const char* mode) {
   return false;
 }
 //------------------------------------------------------------------------------
-int StdioStream::fputs(const char* str) {
+int StdioStreamBase::fputs(const char* str) {
   size_t len = strlen(str);
   return fwrite(str, 1, len) == len ? len : EOF;
 }
 //------------------------------------------------------------------------------
-size_t StdioStream::fread(void* ptr, size_t size, size_t count) {
+size_t StdioStreamBase::fread(void* ptr, size_t size, size_t count) {
   uint8_t* dst = reinterpret_cast<uint8_t*>(ptr);
   size_t total = size*count;
   if (total == 0) {
@@ -178,7 +178,7 @@ size_t StdioStream::fread(void* ptr, size_t size, size_t count) {
   return count;
 }
 //------------------------------------------------------------------------------
-int StdioStream::fseek(int32_t offset, int origin) {
+int StdioStreamBase::fseek(int32_t offset, int origin) {
   int32_t pos;
   if (m_status & S_SWR) {
     if (!flushBuf()) {
@@ -213,6 +213,7 @@ int StdioStream::fseek(int32_t offset, int origin) {
     goto fail;
   }
   m_r = 0;
+  m_w = 0;
   m_p = m_buf;
   return 0;
 
@@ -220,7 +221,7 @@ int StdioStream::fseek(int32_t offset, int origin) {
   return EOF;
 }
 //------------------------------------------------------------------------------
-int32_t StdioStream::ftell() {
+int32_t StdioStreamBase::ftell() {
   uint32_t pos = StreamBaseFile::curPosition();
   if (m_status & S_SRD) {
     if (m_r > pos) {
@@ -233,15 +234,26 @@ int32_t StdioStream::ftell() {
   return pos;
 }
 //------------------------------------------------------------------------------
-size_t StdioStream::fwrite(const void* ptr, size_t size, size_t count) {
+size_t StdioStreamBase::fwrite(const void* ptr, size_t size, size_t count) {
   return write(ptr, count*size) < 0 ? EOF : count;
 }
 //------------------------------------------------------------------------------
-int StdioStream::write(const void* buf, size_t count) {
+int StdioStreamBase::write(const void* buf, size_t count) {
   const uint8_t* src = static_cast<const uint8_t*>(buf);
   size_t todo = count;
 
   while (todo > m_w) {
+    if (m_p == m_buf && m_w == m_size) {
+      // Empty buffer at a buffer boundary - write whole buffers directly.
+      size_t n = todo - todo % m_size;
+      if (StreamBaseFile::write(src, n) != n) {
+        m_status |= S_ERR;
+        return EOF;
+      }
+      src += n;
+      todo -= n;
+      break;
+    }
     memcpy(m_p, src, m_w);
     m_p += m_w;
     src += m_w;
@@ -257,7 +269,7 @@ int StdioStream::write(const void* buf, size_t count) {
 }
 //------------------------------------------------------------------------------
 #if (defined(ARDUINO) && ENABLE_ARDUINO_FEATURES) || defined(DOXYGEN)
-size_t StdioStream::print(const __FlashStringHelper *str) {
+size_t StdioStreamBase::print(const __FlashStringHelper *str) {
   const char *p = (const char*)str;
   uint8_t c;
   while ((c = pgm_read_byte(p))) {
@@ -270,13 +282,13 @@ size_t StdioStream::print(const __FlashStringHelper *str) {
 }
 #endif  // (defined(ARDUINO) && ENABLE_ARDUINO_FEATURES) || defined(DOXYGEN)
 //------------------------------------------------------------------------------
-int StdioStream::printDec(float value, uint8_t prec) {
+int StdioStreamBase::printDec(float value, uint8_t prec) {
   char buf[24];
   char *ptr = fmtDouble(buf + sizeof(buf), value, prec, false);
   return write(ptr, buf + sizeof(buf) - ptr);
 }
 //------------------------------------------------------------------------------
-int StdioStream::printDec(signed char n) {
+int StdioStreamBase::printDec(signed char n) {
   if (n < 0) {
     if (fputc('-') < 0) {
       return -1;
@@ -286,7 +298,7 @@ int StdioStream::printDec(signed char n) {
   return printDec((unsigned char)n);
 }
 //------------------------------------------------------------------------------
-int StdioStream::printDec(int16_t n) {
+int StdioStreamBase::printDec(int16_t n) {
   int s;
   uint8_t rtn = 0;
   if (n < 0) {
@@ -302,14 +314,14 @@ int StdioStream::printDec(int16_t n) {
   return rtn;
 }
 //------------------------------------------------------------------------------
-int StdioStream::printDec(uint16_t n) {
+int StdioStreamBase::printDec(uint16_t n) {
   char buf[5];
   char *ptr = fmtBase10(buf + sizeof(buf), n);
   uint8_t len = buf + sizeof(buf) - ptr;
   return write(ptr, len);
 }
 //------------------------------------------------------------------------------
-int StdioStream::printDec(int32_t n) {
+int StdioStreamBase::printDec(int32_t n) {
   uint8_t s = 0;
   if (n < 0) {
     if (fputc('-') < 0) {
@@ -322,21 +334,21 @@ int StdioStream::printDec(int32_t n) {
   return rtn > 0 ? rtn + s : -1;
 }
 //------------------------------------------------------------------------------
-int StdioStream::printDec(uint32_t n) {
+int StdioStreamBase::printDec(uint32_t n) {
   char buf[10];
   char *ptr = fmtBase10(buf + sizeof(buf), n);
   uint8_t len = buf + sizeof(buf) - ptr;
   return write(ptr, len);
 }
 //------------------------------------------------------------------------------
-int StdioStream::printHex(uint32_t n) {
+int StdioStreamBase::printHex(uint32_t n) {
   char buf[8];
   char *ptr = fmtHex(buf + sizeof(buf), n);
   uint8_t len = buf + sizeof(buf) - ptr;
   return write(ptr, len);
 }
 //------------------------------------------------------------------------------
-bool StdioStream::rewind() {
+bool StdioStreamBase::rewind() {
   if (m_status & S_SWR) {
     if (!flushBuf()) {
       return false;
@@ -344,10 +356,11 @@ bool StdioStream::rewind() {
   }
   StreamBaseFile::seekSet(0);
   m_r = 0;
+  m_w = 0;
   return true;
 }
 //------------------------------------------------------------------------------
-int StdioStream::ungetc(int c) {
+int StdioStreamBase::ungetc(int c) {
   // error if EOF.
   if (c == EOF) {
     return EOF;
@@ -357,7 +370,7 @@ int StdioStream::ungetc(int c) {
     return EOF;
   }
   // error if no space.
-  if (m_p == m_buf) {
+  if (m_p == m_buf - UNGETC_BUF_SIZE) {
     return EOF;
   }
   m_r++;
@@ -367,8 +380,9 @@ int StdioStream::ungetc(int c) {
 //==============================================================================
 // private
 //------------------------------------------------------------------------------
-int StdioStream::fillGet() {
+int StdioStreamBase::fillGet() {
   if (!fillBuf()) {
+    m_r = 0;
     return EOF;
   }
   m_r--;
@@ -376,7 +390,7 @@ int StdioStream::fillGet() {
 }
 //------------------------------------------------------------------------------
 // private
-bool StdioStream::fillBuf() {
+bool StdioStreamBase::fillBuf() {
   if (!(m_status &
         S_SRD)) {  // check for S_ERR and S_EOF ??/////////////////
     if (!(m_status & S_SRW)) {
@@ -392,8 +406,8 @@ bool StdioStream::fillBuf() {
       m_w = 0;
     }
   }
-  m_p = m_buf + UNGETC_BUF_SIZE;
-  int nr = StreamBaseFile::read(m_p, sizeof(m_buf) - UNGETC_BUF_SIZE);
+  m_p = m_buf;
+  int nr = StreamBaseFile::read(m_p, window());
   if (nr <= 0) {
     m_status |= nr < 0 ? S_ERR : S_EOF;
     m_r = 0;
@@ -404,7 +418,7 @@ bool StdioStream::fillBuf() {
 }
 //------------------------------------------------------------------------------
 // private
-bool StdioStream::flushBuf() {
+bool StdioStreamBase::flushBuf() {
   if (!(m_status &
         S_SWR)) {  // check for S_ERR ??////////////////////////
     if (!(m_status & S_SRW)) {
@@ -414,29 +428,36 @@ bool StdioStream::flushBuf() {
     m_status &= ~S_SRD;
     m_status |= S_SWR;
     m_r = 0;
-    m_w = sizeof(m_buf);
+    m_w = window();
     m_p = m_buf;
     return true;
   }
-  uint8_t n = m_p - m_buf;
+  size_t n = m_p - m_buf;
   m_p = m_buf;
-  m_w = sizeof(m_buf);
   if (StreamBaseFile::write(m_buf, n) == n) {
+    m_w = window();
     return true;
   }
   m_status |= S_ERR;
   return false;
 }
 //------------------------------------------------------------------------------
-int StdioStream::flushPut(uint8_t c) {
+// private
+// Bytes from the file position to the next multiple of the buffer size.
+size_t StdioStreamBase::window() {
+  return m_size - StreamBaseFile::curPosition() % m_size;
+}
+//------------------------------------------------------------------------------
+int StdioStreamBase::flushPut(uint8_t c) {
   if (!flushBuf()) {
+    m_w = 0;
     return EOF;
   }
   m_w--;
   return *m_p++ = c;
 }
 //------------------------------------------------------------------------------
-char* StdioStream::fmtSpace(uint8_t len) {
+char* StdioStreamBase::fmtSpace(uint8_t len) {
   if (m_w < len) {
     if (!flushBuf() || m_w < len) {
       return 0;
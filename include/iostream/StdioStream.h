@@ -26,17 +26,20 @@
 #define StdioStream_h
 /**
  * \file
- * \brief StdioStream class
+ * \brief StdioStreamBase, StdioStreamBuf and StdioStream classes
  */
 #include <limits.h>
 #include "ios.h"
 //------------------------------------------------------------------------------
-/** Total size of stream buffer. The entire buffer is used for output.
-  * During input UNGETC_BUF_SIZE of this space is reserved for ungetc.
+/** Size of the stream buffer of StdioStream. The entire buffer is used
+  * for both output and input.
   */
-const uint8_t STREAM_BUF_SIZE = 64;
-/** Amount of buffer allocated for ungetc during input. */
-const uint8_t UNGETC_BUF_SIZE = 2;
+const size_t STREAM_BUF_SIZE = 512;
+/** Amount of buffer allocated in front of the stream buffer for ungetc
+  * during input. A multiple of four, so that the stream buffer stays
+  * aligned.
+  */
+const uint8_t UNGETC_BUF_SIZE = 4;
 //------------------------------------------------------------------------------
 // Get rid of any macros defined in <stdio.h>.
 #include <stdio.h>
@@ -104,17 +107,29 @@ const uint8_t UNGETC_BUF_SIZE = 2;
 #define SEEK_SET 0
 #endif  // SEEK_SET
 //------------------------------------------------------------------------------
-/** \class StdioStream
- * \brief StdioStream implements a minimal stdio stream.
+/** \class StdioStreamBase
+ * \brief StdioStreamBase implements a minimal stdio stream.
+ *
+ * StdioStreamBase does not support subdirectories or long file names.
  *
- * StdioStream does not support subdirectories or long file names.
+ * The buffer is supplied by StdioStreamBuf. Transfers between the buffer
+ * and the file end at multiples of the buffer size in the file, so when the
+ * buffer size is a multiple of the 512 byte sector only the first transfer
+ * after an open or a seek can be a partial sector. Writes of at least a
+ * buffer's worth of data pass straight through to the file in whole buffers.
  */
-class StdioStream : private StreamBaseFile {
- public:
+class StdioStreamBase : private StreamBaseFile {
+ protected:
   /** Constructor
    *
+   * \param[in] buf Four byte aligned buffer, with UNGETC_BUF_SIZE bytes in
+   *            front of it for ungetc.
+   * \param[in] size Size of the buffer.
    */
-  StdioStream() {}
+  StdioStreamBase(uint8_t* buf, size_t size)
+    : m_buf(buf), m_size(size), m_p(buf) {}
+
+ public:
   //----------------------------------------------------------------------------
   /** Clear the stream's end-of-file and error indicators. */
   void clearerr() {
@@ -376,9 +391,7 @@ class StdioStream : private StreamBaseFile {
   inline __attribute__((always_inline))
   int putCRLF() {
     if (m_w < 2) {
-      if (!flushBuf()) {
-        return -1;
-      }
+      return putc('\r') < 0 || putc('\n') < 0 ? -1 : 2;
     }
     *m_p++ = '\r';
     *m_p++ = '\n';
@@ -644,6 +657,7 @@ class StdioStream : private StreamBaseFile {
   bool flushBuf();
   int flushPut(uint8_t c);
   char* fmtSpace(uint8_t len);
+  size_t window();
   int write(const void* buf, size_t count);
   //----------------------------------------------------------------------------
   // S_SRD and S_WR are never simultaneously asserted
@@ -653,11 +667,38 @@ class StdioStream : private StreamBaseFile {
   static const uint8_t S_EOF = 0x10;  // found EOF
   static const uint8_t S_ERR = 0x20;  // found error
   //----------------------------------------------------------------------------
-  uint8_t  m_buf[STREAM_BUF_SIZE];
+  uint8_t* const m_buf;
+  const size_t   m_size;
   uint8_t  m_status = 0;
-  uint8_t* m_p = m_buf;
-  uint8_t  m_r = 0;
-  uint8_t  m_w;
+  uint8_t* m_p;
+  size_t   m_r = 0;
+  size_t   m_w = 0;
 };
 //------------------------------------------------------------------------------
+/** \class StdioStreamBuf
+ * \brief StdioStreamBase with a four byte aligned buffer of BUF_SIZE bytes.
+ *
+ * \tparam BUF_SIZE Size of the stream buffer, a multiple of 512. Larger
+ * buffers mean fewer, longer transfers.
+ */
+template <size_t BUF_SIZE>
+class StdioStreamBuf : public StdioStreamBase {
+  static_assert(BUF_SIZE && BUF_SIZE % 512 == 0,
+                "BUF_SIZE must be a multiple of the 512 byte sector");
+
+ public:
+  /** Constructor */
+  StdioStreamBuf() : StdioStreamBase(m_data + UNGETC_BUF_SIZE, BUF_SIZE) {}
+  StdioStreamBuf(const StdioStreamBuf&) = delete;
+  StdioStreamBuf& operator=(const StdioStreamBuf&) = delete;
+
+ private:
+  alignas(4) uint8_t m_data[UNGETC_BUF_SIZE + BUF_SIZE];
+};
+//------------------------------------------------------------------------------
+/** \class StdioStream
+ * \brief StdioStreamBase with a buffer of STREAM_BUF_SIZE bytes.
+ */
+class StdioStream : public StdioStreamBuf<STREAM_BUF_SIZE> {};
+//------------------------------------------------------------------------------
 #endif  // StdioStream_h
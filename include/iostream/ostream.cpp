@@ -22,6 +22,7 @@
  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
  * DEALINGS IN THE SOFTWARE.
  */
+#include <math.h>
 #include <string.h>
 #include "ostream.h"
 #ifndef PSTR
@@ -61,43 +62,49 @@ void ostream::putChar(char c) {
 //------------------------------------------------------------------------------
 void ostream::putDouble(double n) {
   uint8_t nd = precision();
-  double round = 0.5;
   char sign;
-  char buf[13];  // room for sign, 10 digits, '.', and zero byte
-  char *ptr = buf + sizeof(buf) - 1;
-  char *str = ptr;
-  // terminate string
-  *ptr = '\0';
+  char buf[24];  // room for sign, 21 digits and '.', '.' for showpoint, zero byte
+  char *str = buf + 1;
+  uint8_t nloop = 0;  // fraction digits output by the loop below
+  double fractionPart = 0;
 
-  // get sign and make nonnegative
-  if (n < 0.0) {
+  // get sign (of -0.0 too) and make nonnegative
+  if (signbit(n)) {
     sign = '-';
     n = -n;
   } else {
     sign = flags() & showpos ? '+' : '\0';
   }
-  // check for larger than uint32_t
-  if (n > 4.0E9) {
-    putPgm(PSTR("BIG FLT"));
-    return;
-  }
-  // round up and separate int and fraction parts
-  for (uint8_t i = 0; i < nd; ++i) {
-    round *= 0.1;
+  // format digits and decimal point
+  char *ptr = fmt_fixed(str, buf + sizeof(buf) - 2, n, nd);
+  if (!ptr) {
+    // too many digits for fmt_fixed: integer part and a digit loop, up to uint32_t
+    if (!(n <= 4.0E9)) {
+      putPgm(PSTR("BIG FLT"));
+      return;
+    }
+    double round = 0.5;
+    for (uint8_t i = 0; i < nd; ++i) {
+      round *= 0.1;
+    }
+    n += round;
+    uint32_t intPart = n;
+    fractionPart = n - intPart;
+    ptr = fmt_u32(str, str + 10, intPart);
+    if (nd) {
+      *ptr++ = '.';
+    }
+    nloop = nd;
   }
-  n += round;
-  uint32_t intPart = n;
-  double fractionPart = n - intPart;
-
-  // format intPart and decimal point
-  if (nd || (flags() & showpoint)) {
-    *--str = '.';
+  if (!nd && (flags() & showpoint)) {
+    *ptr++ = '.';
   }
-  str = fmtNum(intPart, str, 10);
+  // terminate string
+  *ptr = '\0';
 
   // calculate length for fill
   uint8_t len = sign ? 1 : 0;
-  len += nd + ptr - str;
+  len += ptr - str + nloop;
 
   // extract adjust field
   fmtflags adj = flags() & adjustfield;
@@ -115,7 +122,7 @@ void ostream::putDouble(double n) {
   }
   putstr(str);
   // output fraction
-  while (nd-- > 0) {
+  while (nloop-- > 0) {
     fractionPart *= 10.0;
     int digit = static_cast<int>(fractionPart);
     putch(digit + '0');
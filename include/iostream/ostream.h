@@ -29,6 +29,7 @@
  * \brief \ref ostream class
  */
 #include "ios.h"
+#include "fmt_number.h"
 //==============================================================================
 /**
  * \class ostream
@@ -299,6 +300,16 @@ class ostream : public virtual ios {
 
   template<typename T>
   char* fmtNum(T n, char *ptr, uint8_t base) {
+    if (base == 10) {  // Two digits at a time
+      if (sizeof(T) > 4) {
+        ptr -= fmt_len_u64(n);
+        fmt_u64(ptr, ptr + 20, n);
+      } else {
+        ptr -= fmt_len_u32(n);
+        fmt_u32(ptr, ptr + 10, n);
+      }
+      return ptr;
+    }
     char a = flags() & uppercase ? 'A' - 10 : 'a' - 10;
     do {
       T m = n;
@@ -194,6 +194,9 @@
 #define FSI_StrucSig		484		/* FAT32 FSI: Structure signature (DWORD) */
 #define FSI_Free_Count		488		/* FAT32 FSI: Number of free clusters (DWORD) */
 #define FSI_Nxt_Free		492		/* FAT32 FSI: Last allocated cluster (DWORD) */
+#define FSI_LzSig			4		/* FAT32 FSI: Lazy sync record signature (DWORD, in FSI_Reserved1) */
+#define FSI_LzRec			8		/* FAT32 FSI: Lazy sync records (DWORD sector, DWORD start cluster, WORD offset, WORD name hash) */
+#define SZ_LZREC			12		/* FAT32 FSI: Size of a lazy sync record */
 
 #define MBR_Table			446		/* MBR: Offset of partition table in the MBR */
 #define SZ_PTE				16		/* MBR: Size of a partition table entry */
@@ -265,6 +268,25 @@
 #define SS(fs)	((fs)->ssize)	/* Variable sector size */
 #endif
 
+#if FF_FAT_CACHE_SECTORS
+#if FF_FAT_CACHE_SECTORS < 2
+#error FF_FAT_CACHE_SECTORS must be 0 or 2 or more
+#endif
+#define FC_PARTS	(FF_FS_EXFAT ? 2 : 1)	/* FAT cache parts (exFAT: FAT and allocation bitmap) */
+#endif
+
+#if FF_FILE_BUFFERS && FF_FS_TINY
+#error FF_FILE_BUFFERS requires FF_FS_TINY == 0
+#endif
+
+#if FF_LAZY_SYNC > 39
+#error FF_LAZY_SYNC must be 39 or less (records must fit in FSInfo)
+#endif
+
+#if FF_PATH_CACHE && (FF_PATH_CACHE_LEN < 1 || FF_PATH_CACHE_LEN > 255)
+#error FF_PATH_CACHE_LEN must be 1 to 255 (path length is held in a BYTE)
+#endif
+
 
 /* Timestamp */
 #if FF_FS_NORTC == 1
@@ -1062,6 +1084,11 @@ static FRESULT sync_window (	/* Returns FR_OK or FR_DISK_ERR */
 	if (fs->wflag) {	/* Is the disk access window dirty? */
 		if (disk_write(fs->pdrv, fs->win, fs->winsect, 1) == RES_OK) {	/* Write it back into the volume */
 			fs->wflag = 0;	/* Clear window dirty flag */
+#if FF_DIR_READAHEAD
+			if (fs->winsect - fs->drasect < fs->dran) {	/* Keep the directory read-ahead buffer up to date */
+				memcpy(fs->drabuf + (UINT)(fs->winsect - fs->drasect) * SS(fs), fs->win, SS(fs));
+			}
+#endif
 			if (fs->winsect - fs->fatbase < fs->fsize) {	/* Is it in the 1st FAT? */
 				if (fs->n_fats == 2) disk_write(fs->pdrv, fs->win, fs->winsect + fs->fsize, 1);	/* Reflect it to 2nd FAT if needed */
 			}
@@ -1099,12 +1126,154 @@ static FRESULT move_window (	/* Returns FR_OK or FR_DISK_ERR */
 
 
 
+#if FF_FAT_CACHE_SECTORS
+/*-----------------------------------------------------------------------*/
+/* Multi-sector cache for the FAT and the allocation bitmap              */
+/*-----------------------------------------------------------------------*/
+/* The cache has a part for the FAT and, on the exFAT volume, a second part
+/  for the allocation bitmap, because allocation alternates between them. */
+
+#if !FF_FS_READONLY
+static FRESULT sync_fat_cache (	/* Returns FR_OK or FR_DISK_ERR */
+	FATFS* fs			/* Filesystem object */
+)
+{
+	UINT k, n;
+	LBA_t sect;
+	const BYTE *p;
+
+
+	for (k = 0; k < FC_PARTS; k++) {
+		if (fs->fcdlo[k] < fs->fcdhi[k]) {	/* Is any part of the cache dirty? */
+			sect = fs->fcsect[k] + fs->fcdlo[k];
+			n = fs->fcdhi[k] - fs->fcdlo[k];
+			p = fs->fcbuf + (k * (FF_FAT_CACHE_SECTORS / 2) + fs->fcdlo[k]) * SS(fs);
+			if (disk_write(fs->pdrv, p, sect, n) != RES_OK) return FR_DISK_ERR;	/* Write back the dirty range in one go */
+			if (sect - fs->fatbase < fs->fsize && fs->n_fats == 2) {	/* Reflect it to 2nd FAT if needed */
+				disk_write(fs->pdrv, p, sect + fs->fsize, n);
+			}
+			fs->fcdlo[k] = FF_FAT_CACHE_SECTORS; fs->fcdhi[k] = 0;	/* Clear dirty range */
+		}
+	}
+	return FR_OK;
+}
+#endif
+
+
+static BYTE* fat_window (	/* Returns pointer to the sector in the cache, 0:Disk error */
+	FATFS* fs,		/* Filesystem object */
+	LBA_t sect		/* Sector LBA in the FAT or the allocation bitmap */
+)
+{
+	UINT k = 0, cap = FF_FAT_CACHE_SECTORS;
+	LBA_t base = fs->fatbase, end = fs->fatbase + fs->fsize;	/* Region holding the sector */
+
+
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) {
+		cap /= 2;
+		if (sect - fs->bitbase < (fs->n_fatent - 2 + 8 * SS(fs) - 1) / (8 * SS(fs))) {	/* In the allocation bitmap? */
+			k = 1;
+			base = fs->bitbase; end = base + (fs->n_fatent - 2 + 8 * SS(fs) - 1) / (8 * SS(fs));
+		}
+	}
+#endif
+	if (sect - fs->fcsect[k] >= fs->fcn[k]) {	/* Cache miss? */
+		if (fs->fcdlo[k] < fs->fcdhi[k]) {	/* Flush the dirty range */
+#if !FF_FS_READONLY
+			if (sync_fat_cache(fs) != FR_OK) return 0;
+#endif
+		}
+		if (sect - base >= end - base) {	/* Not in a known region? */
+			base = sect; end = sect + 1;
+		}
+		base += (sect - base) / cap * cap;	/* Align the cache in the region */
+		fs->fcn[k] = (end - base < cap) ? (UINT)(end - base) : cap;
+		if (disk_read(fs->pdrv, fs->fcbuf + k * cap * SS(fs), base, fs->fcn[k]) != RES_OK) {	/* Fill the cache with one multi-sector read */
+			fs->fcn[k] = 0;	/* Invalidate cache if read data is not valid */
+			return 0;
+		}
+		fs->fcsect[k] = base;
+	}
+	return fs->fcbuf + (k * cap + (UINT)(sect - fs->fcsect[k])) * SS(fs);
+}
+
+
+#if !FF_FS_READONLY
+static void fat_dirty (
+	FATFS* fs,		/* Filesystem object */
+	LBA_t sect		/* Sector LBA in the cache that has been modified */
+)
+{
+	UINT k = (FC_PARTS > 1 && sect - fs->fcsect[FC_PARTS - 1] < fs->fcn[FC_PARTS - 1]) ? FC_PARTS - 1 : 0;
+	UINT i = (UINT)(sect - fs->fcsect[k]);
+
+
+	if (i < fs->fcdlo[k]) fs->fcdlo[k] = i;
+	if (i + 1 > fs->fcdhi[k]) fs->fcdhi[k] = i + 1;
+}
+#endif
+
+#else	/* FAT and bitmap are accessed via the common window */
+#define fat_window(fs, sect)	(move_window(fs, sect) == FR_OK ? (fs)->win : 0)
+#define fat_dirty(fs, sect)		((fs)->wflag = 1)
+#define sync_fat_cache(fs)		FR_OK
+#endif	/* FF_FAT_CACHE_SECTORS */
+
+
+
 
 #if !FF_FS_READONLY
 /*-----------------------------------------------------------------------*/
 /* Synchronize filesystem and data on the storage                        */
 /*-----------------------------------------------------------------------*/
 
+#if FF_LAZY_SYNC
+/*-----------------------------------------------------------------------*/
+/* Lazy sync - Put the records into the FSInfo image in win[]            */
+/*-----------------------------------------------------------------------*/
+/* The directory entries of files whose f_sync has been deferred are
+/  listed in the reserved area of FSInfo, so that the next mount can
+/  bring their size up to date from the cluster chain. Each record holds
+/  the start cluster and a hash of the name as well, so that an entry that
+/  has been reused since is not touched. */
+
+static WORD lz_hash (	/* Hash of the short name in the directory entry */
+	const BYTE* dir		/* Pointer to the directory entry */
+)
+{
+	WORD h = 0;
+	UINT n = 11;
+
+
+	do {
+		h = (WORD)((h >> 1) + (h << 15) + *dir++);
+	} while (--n);
+	return h;
+}
+
+
+static void lz_store (
+	FATFS* fs		/* Filesystem object */
+)
+{
+	UINT i, n = 0;
+
+
+	for (i = 0; i < FF_LAZY_SYNC; i++) {
+		if (fs->lzsect[i] != 0) {
+			st_dword(fs->win + FSI_LzRec + n * SZ_LZREC, fs->lzsect[i]);
+			st_dword(fs->win + FSI_LzRec + n * SZ_LZREC + 4, fs->lzclst[i]);
+			st_word(fs->win + FSI_LzRec + n * SZ_LZREC + 8, fs->lzofs[i]);
+			st_word(fs->win + FSI_LzRec + n * SZ_LZREC + 10, fs->lzhash[i]);
+			n++;
+		}
+	}
+	if (n != 0) st_dword(fs->win + FSI_LzSig, 0x4D5A5943 + n);	/* "CYZM" plus number of records */
+}
+#endif
+
+
 static FRESULT sync_fs (	/* Returns FR_OK or FR_DISK_ERR */
 	FATFS* fs		/* Filesystem object */
 )
@@ -1112,7 +1281,8 @@ static FRESULT sync_fs (	/* Returns FR_OK or FR_DISK_ERR */
 	FRESULT res;
 
 
-	res = sync_window(fs);
+	res = sync_fat_cache(fs);
+	if (res == FR_OK) res = sync_window(fs);
 	if (res == FR_OK) {
 		if (fs->fs_type == FS_FAT32 && fs->fsi_flag == 1) {	/* FAT32: Update FSInfo sector if needed */
 			/* Create FSInfo structure */
@@ -1122,6 +1292,9 @@ static FRESULT sync_fs (	/* Returns FR_OK or FR_DISK_ERR */
 			st_dword(fs->win + FSI_StrucSig, 0x61417272);		/* Structure signature */
 			st_dword(fs->win + FSI_Free_Count, fs->free_clst);	/* Number of free clusters */
 			st_dword(fs->win + FSI_Nxt_Free, fs->last_clst);	/* Last allocated culuster */
+#if FF_LAZY_SYNC
+			lz_store(fs);										/* Entries of files in lazy sync */
+#endif
 			fs->winsect = fs->volbase + 1;						/* Write it into the FSInfo sector (Next to VBR) */
 			disk_write(fs->pdrv, fs->win, fs->winsect, 1);
 			fs->fsi_flag = 0;
@@ -1154,6 +1327,101 @@ static LBA_t clst2sect (	/* !=0:Sector number, 0:Failed (invalid cluster#) */
 
 
 
+#if FF_FREE_MAP_BYTES && !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Free cluster map (FAT12/16/32)                                        */
+/*-----------------------------------------------------------------------*/
+/* One bit per group of 2^fmshift clusters. A bit is cleared only when the
+/  whole group has been seen to be in use, and it is set again whenever a
+/  cluster in the group is freed, so a cleared bit can be trusted. */
+
+static void fmap_init (
+	FATFS* fs,		/* Filesystem object */
+	BYTE v			/* Initial value of each byte (0xFF: all groups may have a free cluster) */
+)
+{
+	BYTE sh = 0;
+
+
+	while (((fs->n_fatent - 1) >> sh) >= FF_FREE_MAP_BYTES * 8) sh++;	/* Fit the volume in the map */
+	fs->fmshift = sh;
+	memset(fs->fmap, v, sizeof fs->fmap);
+}
+
+
+static int fmap_test (	/* 0:No free cluster in the group, !=0:May have a free cluster */
+	FATFS* fs,		/* Filesystem object */
+	DWORD clst		/* Cluster in the group */
+)
+{
+	DWORD g = clst >> fs->fmshift;
+
+
+	return fs->fmap[g / 8] & (1 << (g % 8));
+}
+
+
+static void fmap_put (
+	FATFS* fs,		/* Filesystem object */
+	DWORD clst,		/* Cluster in the group */
+	int v			/* 0:No free cluster in the group, 1:May have a free cluster */
+)
+{
+	DWORD g = clst >> fs->fmshift;
+
+
+	if (v) {
+		fs->fmap[g / 8] |= 1 << (g % 8);
+	} else {
+		fs->fmap[g / 8] &= ~(1 << (g % 8));
+	}
+}
+
+
+static DWORD fmap_last (	/* Last cluster of the group */
+	FATFS* fs,		/* Filesystem object */
+	DWORD clst		/* Cluster in the group */
+)
+{
+	DWORD lcl = clst | (((DWORD)1 << fs->fmshift) - 1);
+
+
+	return (lcl < fs->n_fatent - 1) ? lcl : fs->n_fatent - 1;
+}
+
+#endif	/* FF_FREE_MAP_BYTES && !FF_FS_READONLY */
+
+
+
+
+#if !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Keep the count of an incremental free cluster scan right              */
+/*-----------------------------------------------------------------------*/
+/* Clusters allocated or freed behind the scan position would otherwise be
+/  missed by the count (those ahead of it are counted when they are reached) */
+
+static void gf_track (
+	FATFS* fs,		/* Filesystem object */
+	DWORD clst,		/* First cluster changed */
+	DWORD ncl,		/* Number of clusters changed */
+	int freed		/* 1:Clusters have been freed, 0:Clusters have been allocated */
+)
+{
+	if (fs->gf_clst != 0 && clst < fs->gf_clst) {	/* Is a scan in progress and has it passed the clusters? */
+		if (ncl > fs->gf_clst - clst) ncl = fs->gf_clst - clst;
+		if (freed) {
+			fs->gf_nfree += ncl;
+		} else {
+			fs->gf_nfree -= (ncl < fs->gf_nfree) ? ncl : fs->gf_nfree;
+		}
+	}
+}
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* FAT access - Read value of an FAT entry                               */
 /*-----------------------------------------------------------------------*/
@@ -1165,6 +1433,7 @@ static DWORD get_fat (		/* 0xFFFFFFFF:Disk error, 1:Internal error, 2..0x7FFFFFF
 {
 	UINT wc, bc;
 	DWORD val;
+	BYTE *w;
 	FATFS *fs = obj->fs;
 
 
@@ -1177,21 +1446,21 @@ static DWORD get_fat (		/* 0xFFFFFFFF:Disk error, 1:Internal error, 2..0x7FFFFFF
 		switch (fs->fs_type) {
 		case FS_FAT12 :
 			bc = (UINT)clst; bc += bc / 2;
-			if (move_window(fs, fs->fatbase + (bc / SS(fs))) != FR_OK) break;
-			wc = fs->win[bc++ % SS(fs)];		/* Get 1st byte of the entry */
-			if (move_window(fs, fs->fatbase + (bc / SS(fs))) != FR_OK) break;
-			wc |= fs->win[bc % SS(fs)] << 8;	/* Merge 2nd byte of the entry */
+			if ((w = fat_window(fs, fs->fatbase + (bc / SS(fs)))) == 0) break;
+			wc = w[bc++ % SS(fs)];		/* Get 1st byte of the entry */
+			if ((w = fat_window(fs, fs->fatbase + (bc / SS(fs)))) == 0) break;
+			wc |= w[bc % SS(fs)] << 8;	/* Merge 2nd byte of the entry */
 			val = (clst & 1) ? (wc >> 4) : (wc & 0xFFF);	/* Adjust bit position */
 			break;
 
 		case FS_FAT16 :
-			if (move_window(fs, fs->fatbase + (clst / (SS(fs) / 2))) != FR_OK) break;
-			val = ld_word(fs->win + clst * 2 % SS(fs));		/* Simple WORD array */
+			if ((w = fat_window(fs, fs->fatbase + (clst / (SS(fs) / 2)))) == 0) break;
+			val = ld_word(w + clst * 2 % SS(fs));		/* Simple WORD array */
 			break;
 
 		case FS_FAT32 :
-			if (move_window(fs, fs->fatbase + (clst / (SS(fs) / 4))) != FR_OK) break;
-			val = ld_dword(fs->win + clst * 4 % SS(fs)) & 0x0FFFFFFF;	/* Simple DWORD array but mask out upper 4 bits */
+			if ((w = fat_window(fs, fs->fatbase + (clst / (SS(fs) / 4)))) == 0) break;
+			val = ld_dword(w + clst * 4 % SS(fs)) & 0x0FFFFFFF;	/* Simple DWORD array but mask out upper 4 bits */
 			break;
 #if FF_FS_EXFAT
 		case FS_EXFAT :
@@ -1211,8 +1480,8 @@ static DWORD get_fat (		/* 0xFFFFFFFF:Disk error, 1:Internal error, 2..0x7FFFFFF
 					if (obj->n_frag != 0) {	/* Is it on the growing edge? */
 						val = 0x7FFFFFFF;	/* Generate EOC */
 					} else {
-						if (move_window(fs, fs->fatbase + (clst / (SS(fs) / 4))) != FR_OK) break;
-						val = ld_dword(fs->win + clst * 4 % SS(fs)) & 0x7FFFFFFF;
+						if ((w = fat_window(fs, fs->fatbase + (clst / (SS(fs) / 4)))) == 0) break;
+						val = ld_dword(w + clst * 4 % SS(fs)) & 0x7FFFFFFF;
 					}
 					break;
 				}
@@ -1244,43 +1513,53 @@ static FRESULT put_fat (	/* FR_OK(0):succeeded, !=0:error */
 {
 	UINT bc;
 	BYTE *p;
+	LBA_t sect;
 	FRESULT res = FR_INT_ERR;
 
 
 	if (clst >= 2 && clst < fs->n_fatent) {	/* Check if in valid range */
+#if FF_FREE_MAP_BYTES
+		if (val == 0) fmap_put(fs, clst, 1);	/* The group has a free cluster */
+#endif
 		switch (fs->fs_type) {
 		case FS_FAT12:
 			bc = (UINT)clst; bc += bc / 2;	/* bc: byte offset of the entry */
-			res = move_window(fs, fs->fatbase + (bc / SS(fs)));
-			if (res != FR_OK) break;
-			p = fs->win + bc++ % SS(fs);
+			sect = fs->fatbase + (bc / SS(fs));
+			res = FR_DISK_ERR;
+			if ((p = fat_window(fs, sect)) == 0) break;
+			p += bc++ % SS(fs);
 			*p = (clst & 1) ? ((*p & 0x0F) | ((BYTE)val << 4)) : (BYTE)val;	/* Update 1st byte */
-			fs->wflag = 1;
-			res = move_window(fs, fs->fatbase + (bc / SS(fs)));
-			if (res != FR_OK) break;
-			p = fs->win + bc % SS(fs);
+			fat_dirty(fs, sect);
+			sect = fs->fatbase + (bc / SS(fs));
+			if ((p = fat_window(fs, sect)) == 0) break;
+			p += bc % SS(fs);
 			*p = (clst & 1) ? (BYTE)(val >> 4) : ((*p & 0xF0) | ((BYTE)(val >> 8) & 0x0F));	/* Update 2nd byte */
-			fs->wflag = 1;
+			fat_dirty(fs, sect);
+			res = FR_OK;
 			break;
 
 		case FS_FAT16:
-			res = move_window(fs, fs->fatbase + (clst / (SS(fs) / 2)));
-			if (res != FR_OK) break;
-			st_word(fs->win + clst * 2 % SS(fs), (WORD)val);	/* Simple WORD array */
-			fs->wflag = 1;
+			sect = fs->fatbase + (clst / (SS(fs) / 2));
+			res = FR_DISK_ERR;
+			if ((p = fat_window(fs, sect)) == 0) break;
+			st_word(p + clst * 2 % SS(fs), (WORD)val);	/* Simple WORD array */
+			fat_dirty(fs, sect);
+			res = FR_OK;
 			break;
 
 		case FS_FAT32:
 #if FF_FS_EXFAT
 		case FS_EXFAT:
 #endif
-			res = move_window(fs, fs->fatbase + (clst / (SS(fs) / 4)));
-			if (res != FR_OK) break;
+			sect = fs->fatbase + (clst / (SS(fs) / 4));
+			res = FR_DISK_ERR;
+			if ((p = fat_window(fs, sect)) == 0) break;
 			if (!FF_FS_EXFAT || fs->fs_type != FS_EXFAT) {
-				val = (val & 0x0FFFFFFF) | (ld_dword(fs->win + clst * 4 % SS(fs)) & 0xF0000000);
+				val = (val & 0x0FFFFFFF) | (ld_dword(p + clst * 4 % SS(fs)) & 0xF0000000);
 			}
-			st_dword(fs->win + clst * 4 % SS(fs), val);
-			fs->wflag = 1;
+			st_dword(p + clst * 4 % SS(fs), val);
+			fat_dirty(fs, sect);
+			res = FR_OK;
 			break;
 		}
 	}
@@ -1310,17 +1589,18 @@ static DWORD find_bitmap (	/* 0:Not found, 2..:Cluster block found, 0xFFFFFFFF:D
 	BYTE bm, bv;
 	UINT i;
 	DWORD val, scl, ctr;
+	const BYTE *w;
 
 
 	clst -= 2;	/* The first bit in the bitmap corresponds to cluster #2 */
 	if (clst >= fs->n_fatent - 2) clst = 0;
 	scl = val = clst; ctr = 0;
 	for (;;) {
-		if (move_window(fs, fs->bitbase + val / 8 / SS(fs)) != FR_OK) return 0xFFFFFFFF;
+		if ((w = fat_window(fs, fs->bitbase + val / 8 / SS(fs))) == 0) return 0xFFFFFFFF;
 		i = val / 8 % SS(fs); bm = 1 << (val % 8);
 		do {
 			do {
-				bv = fs->win[i] & bm; bm <<= 1;		/* Get bit value */
+				bv = w[i] & bm; bm <<= 1;		/* Get bit value */
 				if (++val >= fs->n_fatent - 2) {	/* Next cluster (with wrap-around) */
 					val = 0; bm = 0; i = SS(fs);
 				}
@@ -1351,6 +1631,7 @@ static FRESULT change_bitmap (
 	BYTE bm;
 	UINT i;
 	LBA_t sect;
+	BYTE *w;
 
 
 	clst -= 2;	/* The first bit corresponds to cluster #2 */
@@ -1358,17 +1639,17 @@ static FRESULT change_bitmap (
 	i = clst / 8 % SS(fs);					/* Byte offset in the sector */
 	bm = 1 << (clst % 8);					/* Bit mask in the byte */
 	for (;;) {
-		if (move_window(fs, sect++) != FR_OK) return FR_DISK_ERR;
+		if ((w = fat_window(fs, sect)) == 0) return FR_DISK_ERR;
 		do {
 			do {
-				if (bv == (int)((fs->win[i] & bm) != 0)) return FR_INT_ERR;	/* Is the bit expected value? */
-				fs->win[i] ^= bm;	/* Flip the bit */
-				fs->wflag = 1;
+				if (bv == (int)((w[i] & bm) != 0)) return FR_INT_ERR;	/* Is the bit expected value? */
+				w[i] ^= bm;	/* Flip the bit */
+				fat_dirty(fs, sect);
 				if (--ncl == 0) return FR_OK;	/* All bits processed? */
 			} while (bm <<= 1);		/* Next bit */
 			bm = 1;
 		} while (++i < SS(fs));		/* Next byte */
-		i = 0;
+		i = 0; sect++;
 	}
 }
 
@@ -1421,6 +1702,128 @@ static FRESULT fill_last_frag (
 
 
 
+#if FF_BATCH_FREE && !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Batched freeing of cluster chains                      */
+/*-----------------------------------------------------------------------*/
+/* While f_batchfree() has batching enabled on the volume, removed chains are
+/  collected as a sorted list of contiguous cluster blocks and left allocated
+/  until the list is freed in ascending cluster order. This way each FAT (or
+/  allocation bitmap) sector is read and written once, and FSINFO once, for
+/  any number of removed files. */
+
+static FRESULT bf_flush (	/* FR_OK(0):succeeded, !=0:error */
+	FATFS* fs		/* Filesystem object */
+)
+{
+	FRESULT res = FR_OK;
+	UINT i;
+	DWORD clst, ncl, n;
+#if FF_USE_TRIM
+	LBA_t rt[2];
+#endif
+
+
+	for (i = 0; i < fs->bf_n && res == FR_OK; i++) {
+		clst = fs->bf_run[i][0]; ncl = fs->bf_run[i][1];
+#if FF_FS_EXFAT
+		if (fs->fs_type == FS_EXFAT) {
+			res = change_bitmap(fs, clst, ncl, 0);	/* Mark the cluster block 'free' on the bitmap */
+		} else
+#endif
+		{
+			for (n = 0; n < ncl && res == FR_OK; n++) {
+				res = put_fat(fs, clst + n, 0);	/* Mark the cluster 'free' on the FAT */
+			}
+		}
+		if (res != FR_OK) break;
+		if (fs->free_clst < fs->n_fatent - 2) {	/* Update FSINFO */
+			fs->free_clst = (ncl < fs->n_fatent - 2 - fs->free_clst) ? fs->free_clst + ncl : fs->n_fatent - 2;
+			fs->fsi_flag |= 1;
+		}
+		gf_track(fs, clst, ncl, 1);
+#if FF_PREALLOC_CLUSTERS
+		fs->pa_fail = 0;	/* A contiguous area may have become free */
+#endif
+#if FF_USE_TRIM
+		rt[0] = clst2sect(fs, clst);						/* Start of data area to be freed */
+		rt[1] = clst2sect(fs, clst + ncl - 1) + fs->csize - 1;	/* End of data area to be freed */
+		disk_ioctl(fs->pdrv, CTRL_TRIM, rt);				/* Inform storage device that the data in the block may be erased */
+#endif
+	}
+	fs->bf_n = 0;	/* The list is empty (blocks not freed on error are lost clusters) */
+	return res;
+}
+
+
+static FRESULT bf_add (	/* FR_OK(0):succeeded, !=0:error */
+	FATFS* fs,		/* Filesystem object */
+	DWORD clst,		/* First cluster of the block */
+	DWORD ncl		/* Number of clusters in the block */
+)
+{
+	FRESULT res;
+	UINT i;
+
+
+	for (i = 0; i < fs->bf_n && fs->bf_run[i][0] < clst; i++) ;	/* Find the place in the sorted list */
+	if (i > 0 && fs->bf_run[i - 1][0] + fs->bf_run[i - 1][1] == clst) {	/* Does it follow the previous block? */
+		fs->bf_run[i - 1][1] += ncl;
+		if (i < fs->bf_n && clst + ncl == fs->bf_run[i][0]) {	/* Does it close the gap to the next block? */
+			fs->bf_run[i - 1][1] += fs->bf_run[i][1];
+			fs->bf_n--;
+			memmove(fs->bf_run[i], fs->bf_run[i + 1], (fs->bf_n - i) * sizeof fs->bf_run[0]);
+		}
+		return FR_OK;
+	}
+	if (i < fs->bf_n && clst + ncl == fs->bf_run[i][0]) {	/* Does it precede the next block? */
+		fs->bf_run[i][0] = clst;
+		fs->bf_run[i][1] += ncl;
+		return FR_OK;
+	}
+	if (fs->bf_n == FF_BATCH_FREE) {	/* Is the list full? Free the blocks so far */
+		res = bf_flush(fs);
+		if (res != FR_OK) return res;
+		i = 0;
+	}
+	memmove(fs->bf_run[i + 1], fs->bf_run[i], (fs->bf_n - i) * sizeof fs->bf_run[0]);
+	fs->bf_run[i][0] = clst;
+	fs->bf_run[i][1] = ncl;
+	fs->bf_n++;
+	return FR_OK;
+}
+
+
+static FRESULT bf_chain (	/* FR_OK(0):succeeded, !=0:error */
+	FFOBJID* obj,		/* Corresponding object */
+	DWORD clst			/* Cluster to remove a chain from */
+)
+{
+	FRESULT res;
+	DWORD nxt, scl = clst;
+	FATFS *fs = obj->fs;
+
+
+	do {
+		nxt = get_fat(obj, clst);			/* Get cluster status */
+		if (nxt == 0) break;				/* Empty cluster? */
+		if (nxt == 1) return FR_INT_ERR;	/* Internal error? */
+		if (nxt == 0xFFFFFFFF) return FR_DISK_ERR;	/* Disk error? */
+		if (nxt != clst + 1) {				/* End of contiguous cluster block? */
+			res = bf_add(fs, scl, clst - scl + 1);
+			if (res != FR_OK) return res;
+			scl = nxt;
+		}
+		clst = nxt;					/* Next cluster */
+	} while (clst < fs->n_fatent);	/* Repeat while not the last link */
+
+	return (scl < clst && scl < fs->n_fatent) ? bf_add(fs, scl, clst - scl) : FR_OK;	/* Add the block left open, if any */
+}
+
+#endif	/* FF_BATCH_FREE && !FF_FS_READONLY */
+
+
+
 #if !FF_FS_READONLY
 /*-----------------------------------------------------------------------*/
 /* FAT handling - Remove a cluster chain                                 */
@@ -1443,6 +1846,9 @@ static FRESULT remove_chain (	/* FR_OK(0):succeeded, !=0:error */
 #endif
 
 	if (clst < 2 || clst >= fs->n_fatent) return FR_INT_ERR;	/* Check if in valid range */
+#if FF_DIR_READAHEAD
+	fs->dran = 0;	/* The clusters may have been read ahead as a directory */
+#endif
 
 	/* Mark the previous cluster 'EOC' on the FAT if it exists */
 	if (pclst != 0 && (!FF_FS_EXFAT || fs->fs_type != FS_EXFAT || obj->stat != 2)) {
@@ -1451,6 +1857,12 @@ static FRESULT remove_chain (	/* FR_OK(0):succeeded, !=0:error */
 	}
 
 	/* Remove the chain */
+#if FF_BATCH_FREE
+	if (fs->bf_on) {	/* Leave the clusters allocated and put them on the list to be freed later */
+		res = bf_chain(obj, clst);
+		if (res != FR_OK) return res;
+	} else
+#endif
 	do {
 		nxt = get_fat(obj, clst);			/* Get cluster status */
 		if (nxt == 0) break;				/* Empty cluster? */
@@ -1464,6 +1876,10 @@ static FRESULT remove_chain (	/* FR_OK(0):succeeded, !=0:error */
 			fs->free_clst++;
 			fs->fsi_flag |= 1;
 		}
+		gf_track(fs, clst, 1, 1);
+#if FF_PREALLOC_CLUSTERS
+		fs->pa_fail = 0;	/* A contiguous area may have become free */
+#endif
 #if FF_FS_EXFAT || FF_USE_TRIM
 		if (ecl + 1 == nxt) {	/* Is next cluster contiguous? */
 			ecl = nxt;
@@ -1518,44 +1934,29 @@ static FRESULT remove_chain (	/* FR_OK(0):succeeded, !=0:error */
 
 
 /*-----------------------------------------------------------------------*/
-/* FAT handling - Stretch a chain or Create a new chain                  */
+/* FAT handling - Allocate a free cluster and add it to a chain          */
 /*-----------------------------------------------------------------------*/
 
-static DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:New cluster# */
+static DWORD link_chain (	/* 1:Internal error, 0xFFFFFFFF:Disk error, >=2:New cluster# */
 	FFOBJID* obj,		/* Corresponding object */
-	DWORD clst			/* Cluster# to stretch, 0:Create a new chain */
+	DWORD clst,			/* Last cluster# of the chain, 0:Create a new chain */
+	DWORD ncl			/* Free cluster# to be allocated */
 )
 {
-	DWORD cs, ncl, scl;
 	FRESULT res;
 	FATFS *fs = obj->fs;
 
 
-	if (clst == 0) {	/* Create a new chain */
-		scl = fs->last_clst;				/* Suggested cluster to start to find */
-		if (scl == 0 || scl >= fs->n_fatent) scl = 1;
-	}
-	else {				/* Stretch a chain */
-		cs = get_fat(obj, clst);			/* Check the cluster status */
-		if (cs < 2) return 1;				/* Test for insanity */
-		if (cs == 0xFFFFFFFF) return cs;	/* Test for disk error */
-		if (cs < fs->n_fatent) return cs;	/* It is already followed by next cluster */
-		scl = clst;							/* Cluster to start to find */
-	}
-	if (fs->free_clst == 0) return 0;		/* No free cluster */
-
 #if FF_FS_EXFAT
 	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
-		ncl = find_bitmap(fs, scl, 1);				/* Find a free cluster */
-		if (ncl == 0 || ncl == 0xFFFFFFFF) return ncl;	/* No free cluster or hard error? */
 		res = change_bitmap(fs, ncl, 1, 1);			/* Mark the cluster 'in use' */
 		if (res == FR_INT_ERR) return 1;
 		if (res == FR_DISK_ERR) return 0xFFFFFFFF;
 		if (clst == 0) {							/* Is it a new chain? */
 			obj->stat = 2;							/* Set status 'contiguous' */
 		} else {									/* It is a stretched chain */
-			if (obj->stat == 2 && ncl != scl + 1) {	/* Is the chain got fragmented? */
-				obj->n_cont = scl - obj->sclust;	/* Set size of the contiguous part */
+			if (obj->stat == 2 && ncl != clst + 1) {	/* Is the chain got fragmented? */
+				obj->n_cont = clst - obj->sclust;	/* Set size of the contiguous part */
 				obj->stat = 3;						/* Change status 'just fragmented' */
 			}
 		}
@@ -1571,7 +1972,61 @@ static DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:D
 	} else
 #endif
 	{	/* On the FAT/FAT32 volume */
-		ncl = 0;
+		res = put_fat(fs, ncl, 0xFFFFFFFF);		/* Mark the new cluster 'EOC' */
+		if (res == FR_OK && clst != 0) {
+			res = put_fat(fs, clst, ncl);		/* Link it from the previous one if needed */
+		}
+	}
+
+	if (res == FR_OK) {			/* Update FSINFO if function succeeded. */
+		fs->last_clst = ncl;
+		if (fs->free_clst <= fs->n_fatent - 2) fs->free_clst--;
+		gf_track(fs, ncl, 1, 0);
+		fs->fsi_flag |= 1;
+	} else {
+		ncl = (res == FR_DISK_ERR) ? 0xFFFFFFFF : 1;	/* Failed. Generate error status */
+	}
+
+	return ncl;		/* Return new cluster number or error status */
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Stretch a chain or Create a new chain                  */
+/*-----------------------------------------------------------------------*/
+
+static DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:New cluster# */
+	FFOBJID* obj,		/* Corresponding object */
+	DWORD clst			/* Cluster# to stretch, 0:Create a new chain */
+)
+{
+	DWORD cs, ncl, scl;
+	FATFS *fs = obj->fs;
+
+
+	if (clst == 0) {	/* Create a new chain */
+		scl = fs->last_clst;				/* Suggested cluster to start to find */
+		if (scl == 0 || scl >= fs->n_fatent) scl = 1;
+	}
+	else {				/* Stretch a chain */
+		cs = get_fat(obj, clst);			/* Check the cluster status */
+		if (cs < 2) return 1;				/* Test for insanity */
+		if (cs == 0xFFFFFFFF) return cs;	/* Test for disk error */
+		if (cs < fs->n_fatent) return cs;	/* It is already followed by next cluster */
+		scl = clst;							/* Cluster to start to find */
+	}
+	if (fs->free_clst == 0) return 0;		/* No free cluster */
+
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
+		ncl = find_bitmap(fs, scl, 1);				/* Find a free cluster */
+		if (ncl == 0 || ncl == 0xFFFFFFFF) return ncl;	/* No free cluster or hard error? */
+	} else
+#endif
+	{	/* On the FAT/FAT32 volume */
+		ncl = 0;
 		if (scl == clst) {						/* Stretching an existing chain? */
 			ncl = scl + 1;						/* Test if next cluster is free */
 			if (ncl >= fs->n_fatent) ncl = 2;
@@ -1584,6 +2039,9 @@ static DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:D
 			}
 		}
 		if (ncl == 0) {	/* The new cluster cannot be contiguous and find another fragment */
+#if FF_FREE_MAP_BYTES
+			int gfull = 0;	/* All the clusters in this group scanned so far are in use */
+#endif
 			ncl = scl;	/* Start cluster */
 			for (;;) {
 				ncl++;							/* Next cluster */
@@ -1591,27 +2049,218 @@ static DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:D
 					ncl = 2;
 					if (ncl > scl) return 0;	/* No free cluster found? */
 				}
+#if FF_FREE_MAP_BYTES
+				if (!fmap_test(fs, ncl)) {		/* Skip a group with no free cluster */
+					cs = fmap_last(fs, ncl);
+					if (scl >= ncl && scl <= cs) return 0;	/* No free cluster found? */
+					ncl = cs;
+					continue;
+				}
+				if (ncl == 2 || ncl == (ncl >> fs->fmshift << fs->fmshift)) gfull = 1;	/* Top of a group */
+#endif
 				cs = get_fat(obj, ncl);			/* Get the cluster status */
 				if (cs == 0) break;				/* Found a free cluster? */
 				if (cs == 1 || cs == 0xFFFFFFFF) return cs;	/* Test for error */
+#if FF_FREE_MAP_BYTES
+				if (gfull && ncl == fmap_last(fs, ncl)) fmap_put(fs, ncl, 0);	/* Whole group is in use */
+#endif
 				if (ncl == scl) return 0;		/* No free cluster found? */
 			}
 		}
-		res = put_fat(fs, ncl, 0xFFFFFFFF);		/* Mark the new cluster 'EOC' */
-		if (res == FR_OK && clst != 0) {
-			res = put_fat(fs, clst, ncl);		/* Link it from the previous one if needed */
+	}
+
+	return link_chain(obj, clst, ncl);	/* Allocate the free cluster found */
+}
+
+
+
+
+#if FF_PREALLOC_CLUSTERS
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Preallocate contiguous clusters for a growing file     */
+/*-----------------------------------------------------------------------*/
+/* A file opened for writing reserves fp->pa_size clusters at a time, at an
+/  allocation unit boundary of the media where possible, and takes its new
+/  clusters from the head of the reservation. The reserved clusters are 'in
+/  use' on the volume (chained together on the FAT) but not yet part of the
+/  file, so they cannot be taken by other files growing at the same time. */
+
+static DWORD pa_test (	/* 0:Free, 1:In use, 0xFFFFFFFF:Disk error */
+	FFOBJID* obj,	/* Object on the volume */
+	DWORD clst		/* Cluster# to test */
+)
+{
+#if FF_FS_EXFAT
+	FATFS *fs = obj->fs;
+	const BYTE *w;
+
+
+	if (fs->fs_type == FS_EXFAT) {	/* Read the bit in the allocation bitmap */
+		clst -= 2;
+		if ((w = fat_window(fs, fs->bitbase + clst / 8 / SS(fs))) == 0) return 0xFFFFFFFF;
+		return (w[clst / 8 % SS(fs)] >> (clst % 8)) & 1;
+	}
+#endif
+	clst = get_fat(obj, clst);
+	return (clst == 0 || clst == 0xFFFFFFFF) ? clst : 1;
+}
+
+
+static FRESULT pa_reserve (
+	FIL* fp,		/* Pointer to the file object */
+	DWORD clst		/* Last cluster# of the file (0:no cluster) */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	DWORD n, ncl, au, step, top, nc, k, i, scl, val = 0;
+	FRESULT res = FR_OK;
+
+
+	if (fs->pa_au == 0) {	/* Get the allocation unit of the media at first time */
+		if (disk_ioctl(fs->pdrv, GET_ALLOC_UNIT, &au) != RES_OK || au == 0 || au > 0x8000 || (au & (au - 1))) au = 1;
+		fs->pa_au = au;
+	}
+	au = fs->pa_au;
+	step = 1; top = 2;		/* Grid of the candidate start clusters */
+	if (au > fs->csize) {
+		n = (au - (DWORD)fs->database % au) % au;	/* Sectors from the top of data area to the first AU boundary */
+		if (n % fs->csize == 0) {
+			step = au / fs->csize;
+			top = 2 + n / fs->csize;
 		}
 	}
+	ncl = fp->pa_size;
+	if (fs->pa_fail != 0 && ncl >= fs->pa_fail) return FR_OK;	/* No area of this size has been freed since the last failed scan */
+	if (fs->free_clst <= fs->n_fatent - 2 && ncl > fs->free_clst) return FR_OK;	/* Not enough free clusters to reserve */
+	if (top + ncl > fs->n_fatent) return FR_OK;
+	nc = (fs->n_fatent - top - ncl) / step + 1;	/* Number of candidates */
 
-	if (res == FR_OK) {			/* Update FSINFO if function succeeded. */
-		fs->last_clst = ncl;
-		if (fs->free_clst <= fs->n_fatent - 2) fs->free_clst--;
-		fs->fsi_flag |= 1;
-	} else {
-		ncl = (res == FR_DISK_ERR) ? 0xFFFFFFFF : 1;	/* Failed. Generate error status */
+	scl = clst ? clst + 1 : fs->last_clst;	/* Scan from next to the file (or the last allocation) */
+	k = (scl > top) ? (scl - top + step - 1) / step : 0;
+	for (i = 0; i < nc; ) {
+		if (k >= nc) k = 0;			/* Wrap-around */
+		scl = top + k * step;
+		for (n = 0; n < ncl; n++) {	/* Check if the candidate area is free */
+#if FF_FREE_MAP_BYTES
+			if (fs->fs_type != FS_EXFAT && !fmap_test(fs, scl + n)) {	/* A group with no free cluster? */
+				n = fmap_last(fs, scl + n) - scl;
+				val = 1; break;
+			}
+#endif
+			val = pa_test(&fp->obj, scl + n);
+			if (val != 0) break;
+		}
+		if (val == 0xFFFFFFFF) return FR_DISK_ERR;
+		if (n == ncl) break;		/* Found */
+		n = n / step + 1;			/* Skip the candidates containing the cluster in use */
+		i += n; k += n;
+	}
+	if (i >= nc) {					/* No contiguous area (the file grows a cluster at a time) */
+		if (fs->pa_fail == 0 || ncl < fs->pa_fail) fs->pa_fail = ncl;	/* Do not scan again until some clusters are freed */
+		return FR_OK;
 	}
 
-	return ncl;		/* Return new cluster number or error status */
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) {
+		res = change_bitmap(fs, scl, ncl, 1);	/* Mark the area 'in use' */
+	} else
+#endif
+	{
+		for (n = 0; res == FR_OK && n < ncl; n++) {	/* Chain the area on the FAT */
+			res = put_fat(fs, scl + n, (n == ncl - 1) ? 0xFFFFFFFF : scl + n + 1);
+		}
+	}
+	if (res != FR_OK) return res;
+	if (fs->free_clst <= fs->n_fatent - 2) fs->free_clst -= ncl;
+	gf_track(fs, scl, ncl, 0);
+	fs->fsi_flag |= 1;
+	fp->pa_clst = scl; fp->pa_ncl = ncl;
+	return FR_OK;
+}
+
+
+static FRESULT pa_trim (	/* Return the unused reservation to the volume */
+	FIL* fp			/* Pointer to the file object */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	DWORD n;
+	FRESULT res = FR_OK;
+
+
+	if (fp->pa_ncl == 0) return FR_OK;
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) {
+		res = change_bitmap(fs, fp->pa_clst, fp->pa_ncl, 0);	/* Mark the area 'free' */
+	} else
+#endif
+	{
+		for (n = 0; res == FR_OK && n < fp->pa_ncl; n++) {
+			res = put_fat(fs, fp->pa_clst + n, 0);
+		}
+	}
+	if (res != FR_OK) return res;
+	if (fs->free_clst <= fs->n_fatent - 2) fs->free_clst += fp->pa_ncl;
+	gf_track(fs, fp->pa_clst, fp->pa_ncl, 1);
+	fs->pa_fail = 0;	/* A contiguous area may have become free */
+	fs->fsi_flag |= 1;
+	fp->pa_ncl = 0;
+	return FR_OK;
+}
+#endif
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Stretch the chain of a file                            */
+/*-----------------------------------------------------------------------*/
+
+static DWORD stretch_file (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:New cluster# */
+	FIL* fp,		/* Pointer to the file object */
+	DWORD clst		/* Cluster# to stretch, 0:Create a new chain */
+)
+{
+#if FF_PREALLOC_CLUSTERS
+	FATFS *fs = fp->obj.fs;
+	DWORD cs;
+	FRESULT res;
+
+
+	if (fp->pa_size != 0) {
+		if (clst != 0) {
+			cs = get_fat(&fp->obj, clst);		/* Check the cluster status */
+			if (cs < 2) return 1;				/* Test for insanity */
+			if (cs == 0xFFFFFFFF) return cs;	/* Test for disk error */
+			if (cs < fs->n_fatent) return cs;	/* It is already followed by next cluster */
+		}
+		res = FR_OK;
+		if (fp->pa_ncl != 0 && clst != 0 && fp->pa_clst != clst + 1) {	/* Is the reservation apart from the chain? */
+			res = pa_trim(fp);
+		}
+		if (res == FR_OK && fp->pa_ncl == 0) {
+			res = pa_reserve(fp, clst);		/* Reserve the next area */
+		}
+		if (res == FR_OK && fp->pa_ncl != 0) {	/* Free the first reserved cluster and allocate it to the file */
+#if FF_FS_EXFAT
+			if (fs->fs_type == FS_EXFAT) {
+				res = change_bitmap(fs, fp->pa_clst, 1, 0);
+			} else
+#endif
+			{
+				res = put_fat(fs, fp->pa_clst, 0);
+			}
+			if (res == FR_OK) {
+				if (fs->free_clst < fs->n_fatent - 2) fs->free_clst++;
+				gf_track(fs, fp->pa_clst, 1, 1);
+				fp->pa_ncl--;
+				return link_chain(&fp->obj, clst, fp->pa_clst++);
+			}
+		}
+		if (res != FR_OK) return (res == FR_DISK_ERR) ? 0xFFFFFFFF : 1;
+	}
+#endif
+	return create_chain(&fp->obj, clst);
 }
 
 #endif /* !FF_FS_READONLY */
@@ -1619,6 +2268,97 @@ static DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:D
 
 
 
+#if FF_FILE_BUFFERS
+/*-----------------------------------------------------------------------*/
+/* File buffer pool - Get a sector buffer for the file                   */
+/*-----------------------------------------------------------------------*/
+/* Files borrow their sector buffer from the pool in the filesystem object
+/  when they are accessed. When all buffers are in use, the least recently
+/  used one is taken over after writing it back if dirty, and its previous
+/  owner reloads its current sector on its next access. If the write-back
+/  fails, the error is the previous owner's: it keeps the buffer with its
+/  data and gets the hard error, while the borrower gets the error for this
+/  call only. fbuf_bind sets fp->err itself when the file's own sector cannot
+/  be loaded, so callers leave with the result rather than aborting. */
+
+static int fbuf_owned (	/* 1:The buffer is held by an open file, 0:The buffer is free */
+	FATFS* fs,		/* Filesystem object */
+	UINT i			/* Buffer index */
+)
+{
+	FIL *fp = fs->fbown[i];
+
+
+	return fp && fp->buf == fs->fbuf[i] && fp->obj.fs == fs && fp->obj.id == fs->id;
+}
+
+
+static FRESULT fbuf_bind (	/* FR_OK(0):succeeded, !=0:error */
+	FIL* fp,		/* Pointer to the file object */
+	int load		/* 1:Reload the current sector of the file if the buffer has been taken over */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	FIL *ofp;
+	UINT i, v;
+
+
+	if (fp->buf) {	/* Does the file hold a buffer? */
+		fs->fbuse[(fp->buf - fs->fbuf[0]) / FF_MAX_SS] = ++fs->fbtick;
+		return FR_OK;
+	}
+	for (i = v = 0; i < FF_FILE_BUFFERS; i++) {	/* Find a free buffer, or else the least recently used one */
+		if (!fbuf_owned(fs, i)) {
+			v = i; break;
+		}
+		if (fs->fbtick - fs->fbuse[i] > fs->fbtick - fs->fbuse[v]) v = i;
+	}
+	if (fbuf_owned(fs, v)) {	/* Take it over */
+		ofp = fs->fbown[v];
+		if (ofp->flag & FA_DIRTY) {	/* Write-back dirty sector cache */
+			if (disk_write(fs->pdrv, ofp->buf, ofp->sect, 1) != RES_OK) {
+				ofp->err = (BYTE)FR_DISK_ERR;	/* The data lost is the previous owner's */
+				fs->fbuse[v] = ++fs->fbtick;	/* Take another buffer next time */
+				return FR_DISK_ERR;
+			}
+			ofp->flag &= (BYTE)~FA_DIRTY;
+		}
+		ofp->buf = 0;
+	}
+	fs->fbown[v] = fp;
+	fs->fbuse[v] = ++fs->fbtick;
+	fp->buf = fs->fbuf[v];
+	if (load && fp->sect != 0) {	/* Reload the current sector */
+		if (disk_read(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) {
+			fp->err = (BYTE)FR_DISK_ERR;
+			return FR_DISK_ERR;
+		}
+	}
+	return FR_OK;
+}
+
+
+static void fbuf_release (
+	FIL* fp		/* Pointer to the file object */
+)
+{
+	FATFS *fs = fp->obj.fs;
+
+
+	if (fp->buf) {	/* Return the buffer to the pool */
+		fs->fbown[(fp->buf - fs->fbuf[0]) / FF_MAX_SS] = 0;
+		fp->buf = 0;
+	}
+}
+
+#else
+#define fbuf_bind(fp, load)	FR_OK
+#define fbuf_release(fp)
+#endif
+
+
+
+
 #if FF_USE_FASTSEEK
 /*-----------------------------------------------------------------------*/
 /* FAT handling - Convert offset into cluster with link map table        */
@@ -1645,6 +2385,126 @@ static DWORD clmt_clust (	/* <2:Error, >=2:Cluster number */
 	return cl + *tbl;	/* Return the cluster number */
 }
 
+
+static FRESULT clmt_create (	/* FR_OK(0):succeeded, FR_NOT_ENOUGH_CORE:table is too small, !=0:error */
+	FIL* fp,		/* Pointer to the file object (cltbl[0]: size of the table in items) */
+	int full		/* 1:Follow the whole chain to get the required size even if the table is too small */
+)
+{
+	DWORD cl, pcl, ncl, tcl, tlen, ulen;
+	DWORD *tbl;
+	FATFS *fs = fp->obj.fs;
+
+
+	tbl = fp->cltbl;
+	tlen = *tbl++; ulen = 2;	/* Given table size and required table size */
+	cl = fp->obj.sclust;		/* Origin of the chain */
+	if (cl != 0) {
+		do {
+			/* Get a fragment */
+			tcl = cl; ncl = 0; ulen += 2;	/* Top, length and used items */
+			do {
+				pcl = cl; ncl++;
+				cl = get_fat(&fp->obj, cl);
+				if (cl <= 1) return FR_INT_ERR;
+				if (cl == 0xFFFFFFFF) return FR_DISK_ERR;
+			} while (cl == pcl + 1);
+			if (ulen <= tlen) {		/* Store the length and top of the fragment */
+				*tbl++ = ncl; *tbl++ = tcl;
+			} else {
+				if (!full) break;	/* No point in going on */
+			}
+		} while (cl < fs->n_fatent);	/* Repeat until end of chain */
+	}
+	*fp->cltbl = ulen;	/* Number of items used */
+	if (ulen > tlen) return FR_NOT_ENOUGH_CORE;	/* Given table size is smaller than required */
+	*tbl = 0;		/* Terminate table */
+	return FR_OK;
+}
+
+
+#if FF_AUTO_CLMT
+/*-----------------------------------------------------------------------*/
+/* Automatic CLMT - Maps from the pool of the volume                     */
+/*-----------------------------------------------------------------------*/
+/* fp->clmtslot is 0 when the file has no automatic map, 1..FF_AUTO_CLMT
+/  when it has the map in that slot, 0xFE when it has made one random seek
+/  and 0xFF when its chain did not fit. A file is mapped on its second random
+/  seek (one that moves the file pointer to other than the end of the file),
+/  so files that are read or written through, appended to or rewound once do
+/  not take a table from the pool. */
+
+#if FF_AUTO_CLMT_SIZE < 4 || FF_AUTO_CLMT > 253
+#error Wrong FF_AUTO_CLMT or FF_AUTO_CLMT_SIZE setting
+#endif
+
+static int clmt_owned (	/* 1:The file is using its automatic map */
+	FIL* fp		/* Pointer to the file object */
+)
+{
+	return fp->clmtslot >= 1 && fp->clmtslot <= FF_AUTO_CLMT && fp->cltbl == fp->obj.fs->clmtbuf[fp->clmtslot - 1];
+}
+
+
+static void clmt_release (
+	FIL* fp		/* Pointer to the file object */
+)
+{
+	if (fp->clmtslot >= 1 && fp->clmtslot <= FF_AUTO_CLMT) {
+		if (clmt_owned(fp)) fp->cltbl = 0;	/* Back to normal seek mode */
+		fp->obj.fs->clmtuse[fp->clmtslot - 1] = 0;
+		fp->clmtslot = 0;
+	}
+}
+
+
+static void clmt_auto (	/* Give the file an automatic map if the pool has room and the chain fits */
+	FIL* fp		/* Pointer to the file object */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	UINT i;
+	FRESULT res;
+
+
+	for (i = 0; i < FF_AUTO_CLMT && fs->clmtuse[i]; i++) ;
+	if (i == FF_AUTO_CLMT) return;	/* Pool is exhausted (try again later) */
+	fp->cltbl = fs->clmtbuf[i];
+	fp->cltbl[0] = FF_AUTO_CLMT_SIZE;
+	res = clmt_create(fp, 0);
+	if (res == FR_OK) {
+		fs->clmtuse[i] = 1; fp->clmtslot = (BYTE)(i + 1);
+	} else {		/* Fall back to normal seek mode (errors are caught there) */
+		fp->cltbl = 0;
+		if (res == FR_NOT_ENOUGH_CORE) fp->clmtslot = 0xFF;	/* Do not try again */
+	}
+}
+
+
+#if !FF_FS_READONLY
+static void clmt_append (	/* Add a cluster appended to the chain to the map */
+	FIL* fp,		/* Pointer to the file object */
+	DWORD clst		/* New last cluster of the file */
+)
+{
+	DWORD *tbl = fp->cltbl;
+	DWORD ulen = tbl[0];	/* Items used (the last one is the terminator) */
+
+
+	if (ulen > 2 && tbl[ulen - 2] + tbl[ulen - 3] == clst) {	/* Contiguous to the last fragment? */
+		tbl[ulen - 3]++;
+	} else if (ulen + 2 <= FF_AUTO_CLMT_SIZE) {	/* Add a fragment */
+		tbl[ulen - 1] = 1; tbl[ulen] = clst; tbl[ulen + 1] = 0;
+		tbl[0] = ulen + 2;
+	} else {		/* No room: the file goes back to normal seek mode */
+		clmt_release(fp);
+		fp->clmtslot = 0xFF;
+	}
+}
+#endif
+
+#endif	/* FF_AUTO_CLMT */
+
 #endif	/* FF_USE_FASTSEEK */
 
 
@@ -1666,6 +2526,9 @@ static FRESULT dir_clear (	/* Returns FR_OK or FR_DISK_ERR */
 
 
 	if (sync_window(fs) != FR_OK) return FR_DISK_ERR;	/* Flush disk access window */
+#if FF_DIR_READAHEAD
+	fs->dran = 0;					/* Discard the directory read-ahead */
+#endif
 	sect = clst2sect(fs, clst);		/* Top of the cluster */
 	fs->winsect = sect;				/* Set window to top of the cluster */
 	memset(fs->win, 0, sizeof fs->win);	/* Clear window buffer */
@@ -1690,6 +2553,51 @@ static FRESULT dir_clear (	/* Returns FR_OK or FR_DISK_ERR */
 
 
 
+#if FF_DIR_READAHEAD
+/*-----------------------------------------------------------------------*/
+/* Directory handling - Load a directory sector with read-ahead          */
+/*-----------------------------------------------------------------------*/
+/* Reads the rest of the cluster (or of the static root directory) up to
+/  FF_DIR_READAHEAD sectors in a multi-sector read, and serves the following
+/  sectors of the directory from the copy */
+
+static FRESULT move_dir_window (	/* Returns FR_OK or FR_DISK_ERR */
+	DIR* dp			/* Directory object pointing the sector to load into win[] */
+)
+{
+	FATFS *fs = dp->obj.fs;
+	LBA_t sect = dp->sect;
+	UINT n;
+
+
+	if (sect == fs->winsect) return FR_OK;	/* Already in the window */
+	if (sect - fs->drasect >= fs->dran) {	/* Not in the read-ahead buffer? */
+		if (dp->clust == 0) {	/* Static table (FAT12/16 root directory) */
+			n = (UINT)(fs->dirbase + fs->n_rootdir / (SS(fs) / SZDIRE) - sect);
+		} else {				/* Dynamic table */
+			n = (UINT)(clst2sect(fs, dp->clust) + fs->csize - sect);
+		}
+		if (n > FF_DIR_READAHEAD) n = FF_DIR_READAHEAD;
+		if (n <= 1) return move_window(fs, sect);	/* Nothing to read ahead */
+		fs->dran = 0;
+		if (disk_read(fs->pdrv, fs->drabuf, sect, n) != RES_OK) return FR_DISK_ERR;
+		fs->drasect = sect;
+		fs->dran = n;
+	}
+#if !FF_FS_READONLY
+	if (sync_window(fs) != FR_OK) return FR_DISK_ERR;	/* Flush the window */
+#endif
+	memcpy(fs->win, fs->drabuf + (UINT)(sect - fs->drasect) * SS(fs), SS(fs));
+	fs->winsect = sect;
+	return FR_OK;
+}
+#else
+#define move_dir_window(dp)	move_window((dp)->obj.fs, (dp)->sect)
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Directory handling - Set directory index                              */
 /*-----------------------------------------------------------------------*/
@@ -1898,9 +2806,10 @@ static int cmp_lfn (		/* 1:matched, 0:not matched */
 	for (wc = 1, s = 0; s < 13; s++) {		/* Process all characters in the entry */
 		uc = ld_word(dir + LfnOfs[s]);		/* Pick an LFN character */
 		if (wc != 0) {
-			if (i >= FF_MAX_LFN + 1 || ff_wtoupper(uc) != ff_wtoupper(lfnbuf[i++])) {	/* Compare it */
+			if (i >= FF_MAX_LFN + 1 || (uc != lfnbuf[i] && ff_wtoupper(uc) != ff_wtoupper(lfnbuf[i]))) {	/* Compare it (up-case convert only if different) */
 				return 0;					/* Not matched */
 			}
+			i++;
 			wc = uc;
 		} else {
 			if (uc != 0xFFFF) return 0;		/* Check filler */
@@ -2137,7 +3046,7 @@ static FRESULT load_xdir (	/* FR_INT_ERR: invalid entry block */
 
 
 	/* Load file directory entry */
-	res = move_window(dp->obj.fs, dp->sect);
+	res = move_dir_window(dp);
 	if (res != FR_OK) return res;
 	if (dp->dir[XDIR_Type] != ET_FILEDIR) return FR_INT_ERR;	/* Invalid order */
 	memcpy(dirb + 0 * SZDIRE, dp->dir, SZDIRE);
@@ -2148,7 +3057,7 @@ static FRESULT load_xdir (	/* FR_INT_ERR: invalid entry block */
 	res = dir_next(dp, 0);
 	if (res == FR_NO_FILE) res = FR_INT_ERR;	/* It cannot be */
 	if (res != FR_OK) return res;
-	res = move_window(dp->obj.fs, dp->sect);
+	res = move_dir_window(dp);
 	if (res != FR_OK) return res;
 	if (dp->dir[XDIR_Type] != ET_STREAM) return FR_INT_ERR;	/* Invalid order */
 	memcpy(dirb + 1 * SZDIRE, dp->dir, SZDIRE);
@@ -2160,7 +3069,7 @@ static FRESULT load_xdir (	/* FR_INT_ERR: invalid entry block */
 		res = dir_next(dp, 0);
 		if (res == FR_NO_FILE) res = FR_INT_ERR;	/* It cannot be */
 		if (res != FR_OK) return res;
-		res = move_window(dp->obj.fs, dp->sect);
+		res = move_dir_window(dp);
 		if (res != FR_OK) return res;
 		if (dp->dir[XDIR_Type] != ET_FILENAME) return FR_INT_ERR;	/* Invalid order */
 		if (i < MAXDIRB(FF_MAX_LFN)) memcpy(dirb + i, dp->dir, SZDIRE);
@@ -2285,95 +3194,343 @@ static void create_xdir (
 		nc1++;
 	} while (lfn[nlen]);	/* Fill next entry if any char follows */
 
-	dirb[XDIR_NumName] = nlen;		/* Set name length */
-	dirb[XDIR_NumSec] = 1 + nc1;	/* Set secondary count (C0 + C1s) */
-	st_word(dirb + XDIR_NameHash, xname_sum(lfn));	/* Set name hash */
+	dirb[XDIR_NumName] = nlen;		/* Set name length */
+	dirb[XDIR_NumSec] = 1 + nc1;	/* Set secondary count (C0 + C1s) */
+	st_word(dirb + XDIR_NameHash, xname_sum(lfn));	/* Set name hash */
+}
+
+#endif	/* !FF_FS_READONLY */
+#endif	/* FF_FS_EXFAT */
+
+
+
+#if FF_FS_MINIMIZE <= 1 || FF_FS_RPATH >= 2 || FF_USE_LABEL || FF_FS_EXFAT
+/*-----------------------------------------------------------------------*/
+/* Read an object from the directory                                     */
+/*-----------------------------------------------------------------------*/
+
+#define DIR_READ_FILE(dp) dir_read(dp, 0)
+#define DIR_READ_LABEL(dp) dir_read(dp, 1)
+
+static FRESULT dir_read (
+	DIR* dp,		/* Pointer to the directory object */
+	int vol			/* Filtered by 0:file/directory or 1:volume label */
+)
+{
+	FRESULT res = FR_NO_FILE;
+	FATFS *fs = dp->obj.fs;
+	BYTE attr, b;
+#if FF_USE_LFN
+	BYTE ord = 0xFF, sum = 0xFF;
+#endif
+
+	while (dp->sect) {
+		res = move_dir_window(dp);
+		if (res != FR_OK) break;
+		b = dp->dir[DIR_Name];	/* Test for the entry type */
+		if (b == 0) {
+			res = FR_NO_FILE; break; /* Reached to end of the directory */
+		}
+#if FF_FS_EXFAT
+		if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
+			if (FF_USE_LABEL && vol) {
+				if (b == ET_VLABEL) break;	/* Volume label entry? */
+			} else {
+				if (b == ET_FILEDIR) {		/* Start of the file entry block? */
+					dp->blk_ofs = dp->dptr;	/* Get location of the block */
+					res = load_xdir(dp);	/* Load the entry block */
+					if (res == FR_OK) {
+						dp->obj.attr = fs->dirbuf[XDIR_Attr] & AM_MASK;	/* Get attribute */
+					}
+					break;
+				}
+			}
+		} else
+#endif
+		{	/* On the FAT/FAT32 volume */
+			dp->obj.attr = attr = dp->dir[DIR_Attr] & AM_MASK;	/* Get attribute */
+#if FF_USE_LFN		/* LFN configuration */
+			if (b == DDEM || b == '.' || (int)((attr & ~AM_ARC) == AM_VOL) != vol) {	/* An entry without valid data */
+				ord = 0xFF;
+			} else {
+				if (attr == AM_LFN) {	/* An LFN entry is found */
+					if (b & LLEF) {		/* Is it start of an LFN sequence? */
+						sum = dp->dir[LDIR_Chksum];
+						b &= (BYTE)~LLEF; ord = b;
+						dp->blk_ofs = dp->dptr;
+					}
+					/* Check LFN validity and capture it */
+					ord = (b == ord && sum == dp->dir[LDIR_Chksum] && pick_lfn(fs->lfnbuf, dp->dir)) ? ord - 1 : 0xFF;
+				} else {				/* An SFN entry is found */
+					if (ord != 0 || sum != sum_sfn(dp->dir)) {	/* Is there a valid LFN? */
+						dp->blk_ofs = 0xFFFFFFFF;	/* It has no LFN. */
+					}
+					break;
+				}
+			}
+#else		/* Non LFN configuration */
+			if (b != DDEM && b != '.' && attr != AM_LFN && (int)((attr & ~AM_ARC) == AM_VOL) == vol) {	/* Is it a valid entry? */
+				break;
+			}
+#endif
+		}
+		res = dir_next(dp, 0);		/* Next entry */
+		if (res != FR_OK) break;
+	}
+
+	if (res != FR_OK) dp->sect = 0;		/* Terminate the read operation on error or EOT */
+	return res;
+}
+
+#endif	/* FF_FS_MINIMIZE <= 1 || FF_USE_LABEL || FF_FS_RPATH >= 2 */
+
+
+
+#if FF_PATH_CACHE
+/*-----------------------------------------------------------------------*/
+/* Path cache - Directories recently reached by follow_path              */
+/*-----------------------------------------------------------------------*/
+/* Each entry maps the directory part of a path, as written, and the
+/  directory it was relative to, to the state of the directory object at the
+/  end of it. Entries are kept in most recently used order. */
+
+static void pcache_clear (
+	FATFS* fs		/* Filesystem object */
+)
+{
+	UINT i;
+
+
+	for (i = 0; i < FF_PATH_CACHE; i++) fs->pcache[i].len = 0;
+}
+
+
+static const TCHAR* pcache_split (	/* Returns pointer to the last segment of the path */
+	const TCHAR* path,	/* Path name (without heading separator) */
+	UINT* len			/* Returns length of the directory part (0:no directory part) */
+)
+{
+	const TCHAR *p = path, *last = path, *q;
+
+
+	*len = 0;
+	while (!IsTerminator(*p)) {
+		if (IsSeparator(*p)) {
+			q = p;
+			while (IsSeparator(*p)) p++;
+			if (!IsTerminator(*p)) {	/* Not trailing separators? */
+				*len = (UINT)(q - path); last = p;
+			}
+		} else {
+			p++;
+		}
+	}
+	return last;
+}
+
+
+static int pcache_find (	/* 1:Hit, 0:Miss */
+	DIR* dp,			/* Directory object at the starting directory */
+	const TCHAR* path,	/* Path name */
+	UINT len			/* Length of the directory part */
+)
+{
+	FATFS *fs = dp->obj.fs;
+	PCENT ent;
+	UINT i;
+
+
+	for (i = 0; i < FF_PATH_CACHE; i++) {
+		ent = fs->pcache[i];
+		if (ent.len == len && ent.base == dp->obj.sclust && !memcmp(ent.path, path, len * sizeof (TCHAR))) {
+			for ( ; i > 0; i--) fs->pcache[i] = fs->pcache[i - 1];	/* Move it to the front */
+			fs->pcache[0] = ent;
+			dp->obj.sclust = ent.sclust;	/* Enter the directory */
+#if FF_FS_EXFAT
+			dp->obj.objsize = ent.objsize;
+			dp->obj.stat = ent.stat;
+			dp->obj.c_scl = ent.c_scl;
+			dp->obj.c_size = ent.c_size;
+			dp->obj.c_ofs = ent.c_ofs;
+#endif
+			return 1;
+		}
+	}
+	return 0;
+}
+
+
+static void pcache_put (
+	DIR* dp,			/* Directory object just entered at the end of the directory part */
+	DWORD base,			/* Start cluster of the starting directory */
+	const TCHAR* path,	/* Path name */
+	UINT len			/* Length of the directory part */
+)
+{
+	FATFS *fs = dp->obj.fs;
+	UINT i;
+
+
+	for (i = FF_PATH_CACHE - 1; i > 0; i--) fs->pcache[i] = fs->pcache[i - 1];	/* Drop the least recently used one */
+	fs->pcache[0].len = (BYTE)len;
+	memcpy(fs->pcache[0].path, path, len * sizeof (TCHAR));
+	fs->pcache[0].base = base;
+	fs->pcache[0].sclust = dp->obj.sclust;
+#if FF_FS_EXFAT
+	fs->pcache[0].objsize = dp->obj.objsize;
+	fs->pcache[0].stat = dp->obj.stat;
+	fs->pcache[0].c_scl = dp->obj.c_scl;
+	fs->pcache[0].c_size = dp->obj.c_size;
+	fs->pcache[0].c_ofs = dp->obj.c_ofs;
+#endif
+}
+
+#endif	/* FF_PATH_CACHE */
+
+
+
+
+#if FF_DIR_INDEX_SIZE
+/*-----------------------------------------------------------------------*/
+/* Directory handling - In-RAM index of a large directory                */
+/*-----------------------------------------------------------------------*/
+/* The index holds the offset and name hashes of each entry block from the
+/  offset dixhead to dixend of one directory per volume. The entries above
+/  dixhead are always searched linearly, so that small directories passed
+/  through on the way to a file do not take the index over. The entries from
+/  dixend on are searched linearly and added to the index as they are found.
+/  A record is only a hint: the entry block is always verified against the
+/  name, so a stale record costs a read, not a wrong result. */
+
+#if !FF_USE_LFN
+#error FF_DIR_INDEX_SIZE requires FF_USE_LFN
+#endif
+
+#define DIX_HEAD	2048	/* Size of the unindexed top of a directory [byte] */
+
+
+static DWORD dix_term (	/* Hash term of a character at a position in the name */
+	WCHAR c,		/* Character (up-converted for LFN) */
+	UINT i			/* Position in the name */
+)
+{
+	DWORD t = ((DWORD)c << 16 | i) * 0x9E3779B1;
+
+
+	return t ^ (t >> 16);	/* Terms are summed, so an LFN can be hashed in any entry order */
+}
+
+
+static WORD dix_fold (	/* Hash value of a name */
+	DWORD h			/* Sum of the hash terms */
+)
+{
+	return (WORD)(h ^ (h >> 16));
+}
+
+
+static DWORD dix_lfn (	/* Sum of the hash terms of the name characters in an LFN entry */
+	const BYTE* dir	/* Pointer to the LFN entry */
+)
+{
+	UINT i, s;
+	WCHAR wc;
+	DWORD h = 0;
+
+
+	i = ((dir[LDIR_Ord] & ~LLEF) - 1) * 13;	/* Offset in the LFN buffer */
+	for (s = 0; s < 13; s++) {
+		wc = ld_word(dir + LfnOfs[s]);
+		if (wc == 0) break;		/* End of the name */
+		h += dix_term(ff_wtoupper(wc), i + s);
+	}
+	return h;
+}
+
+
+static WORD dix_sfn (	/* Hash value of an SFN */
+	const BYTE* sfn	/* Pointer to the 11-byte SFN */
+)
+{
+	UINT i;
+	DWORD h = 0;
+
+
+	for (i = 0; i < 11; i++) h += dix_term(sfn[i], i);
+	return dix_fold(h);
 }
 
-#endif	/* !FF_FS_READONLY */
-#endif	/* FF_FS_EXFAT */
 
+static int dix_put (	/* 1:Added or replaced, 0:Index is full */
+	FATFS* fs,		/* Filesystem object */
+	DWORD ofs,		/* Offset of the entry block */
+	WORD lh,		/* Hash of the LFN (exFAT: name hash) */
+	WORD sh			/* Hash of the SFN */
+)
+{
+	UINT i;
 
 
-#if FF_FS_MINIMIZE <= 1 || FF_FS_RPATH >= 2 || FF_USE_LABEL || FF_FS_EXFAT
-/*-----------------------------------------------------------------------*/
-/* Read an object from the directory                                     */
-/*-----------------------------------------------------------------------*/
+	for (i = 0; i < fs->dixn && fs->dix[i].ofs != ofs; i++) ;	/* A record of an old block at this offset (rescanned, or left after a delete or rename)? */
+	if (i == fs->dixn) {
+		if (fs->dixn >= FF_DIR_INDEX_SIZE) return 0;
+		fs->dixn++;
+	}
+	fs->dix[i].ofs = ofs;	/* Replace it, so that a block is never in the index twice */
+	fs->dix[i].lhash = lh;
+	fs->dix[i].shash = sh;
+	return 1;
+}
 
-#define DIR_READ_FILE(dp) dir_read(dp, 0)
-#define DIR_READ_LABEL(dp) dir_read(dp, 1)
 
-static FRESULT dir_read (
-	DIR* dp,		/* Pointer to the directory object */
-	int vol			/* Filtered by 0:file/directory or 1:volume label */
+#if !FF_FS_READONLY
+static void dix_add (
+	DIR* dp,		/* Directory object */
+	DWORD ofs,		/* Offset of the entry block just created */
+	WORD lh,		/* Hash of the LFN (exFAT: name hash) */
+	WORD sh			/* Hash of the SFN */
 )
 {
-	FRESULT res = FR_NO_FILE;
 	FATFS *fs = dp->obj.fs;
-	BYTE attr, b;
-#if FF_USE_LFN
-	BYTE ord = 0xFF, sum = 0xFF;
-#endif
+	UINT i;
 
-	while (dp->sect) {
-		res = move_window(fs, dp->sect);
-		if (res != FR_OK) break;
-		b = dp->dir[DIR_Name];	/* Test for the entry type */
-		if (b == 0) {
-			res = FR_NO_FILE; break; /* Reached to end of the directory */
-		}
-#if FF_FS_EXFAT
-		if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
-			if (FF_USE_LABEL && vol) {
-				if (b == ET_VLABEL) break;	/* Volume label entry? */
-			} else {
-				if (b == ET_FILEDIR) {		/* Start of the file entry block? */
-					dp->blk_ofs = dp->dptr;	/* Get location of the block */
-					res = load_xdir(dp);	/* Load the entry block */
-					if (res == FR_OK) {
-						dp->obj.attr = fs->dirbuf[XDIR_Attr] & AM_MASK;	/* Get attribute */
-					}
-					break;
-				}
-			}
-		} else
-#endif
-		{	/* On the FAT/FAT32 volume */
-			dp->obj.attr = attr = dp->dir[DIR_Attr] & AM_MASK;	/* Get attribute */
-#if FF_USE_LFN		/* LFN configuration */
-			if (b == DDEM || b == '.' || (int)((attr & ~AM_ARC) == AM_VOL) != vol) {	/* An entry without valid data */
-				ord = 0xFF;
+
+	if (!fs->dixstat || fs->dixclst != dp->obj.sclust) return;	/* Not the indexed directory? */
+	if (ofs < fs->dixhead || ofs >= fs->dixend) return;		/* Will be found by the linear search? */
+	if (!dix_put(fs, ofs, lh, sh)) {	/* No room? */
+		fs->dixend = ofs;				/* Hand this block and beyond back to the linear search */
+		for (i = 0; i < fs->dixn; ) {
+			if (fs->dix[i].ofs >= ofs) {
+				fs->dix[i] = fs->dix[--fs->dixn];
 			} else {
-				if (attr == AM_LFN) {	/* An LFN entry is found */
-					if (b & LLEF) {		/* Is it start of an LFN sequence? */
-						sum = dp->dir[LDIR_Chksum];
-						b &= (BYTE)~LLEF; ord = b;
-						dp->blk_ofs = dp->dptr;
-					}
-					/* Check LFN validity and capture it */
-					ord = (b == ord && sum == dp->dir[LDIR_Chksum] && pick_lfn(fs->lfnbuf, dp->dir)) ? ord - 1 : 0xFF;
-				} else {				/* An SFN entry is found */
-					if (ord != 0 || sum != sum_sfn(dp->dir)) {	/* Is there a valid LFN? */
-						dp->blk_ofs = 0xFFFFFFFF;	/* It has no LFN. */
-					}
-					break;
-				}
-			}
-#else		/* Non LFN configuration */
-			if (b != DDEM && b != '.' && attr != AM_LFN && (int)((attr & ~AM_ARC) == AM_VOL) == vol) {	/* Is it a valid entry? */
-				break;
+				i++;
 			}
-#endif
 		}
-		res = dir_next(dp, 0);		/* Next entry */
-		if (res != FR_OK) break;
 	}
+}
 
-	if (res != FR_OK) dp->sect = 0;		/* Terminate the read operation on error or EOT */
-	return res;
+
+static void dix_remove (
+	DIR* dp,		/* Directory object */
+	DWORD ofs		/* Offset of the entry block to be removed */
+)
+{
+	FATFS *fs = dp->obj.fs;
+	UINT i;
+
+
+	if (!fs->dixstat || fs->dixclst != dp->obj.sclust) return;	/* Not the indexed directory? */
+	for (i = 0; i < fs->dixn; i++) {
+		if (fs->dix[i].ofs == ofs) {
+			fs->dix[i] = fs->dix[--fs->dixn];
+			break;
+		}
+	}
 }
+#endif	/* !FF_FS_READONLY */
+
+#endif	/* FF_DIR_INDEX_SIZE */
 
-#endif	/* FF_FS_MINIMIZE <= 1 || FF_USE_LABEL || FF_FS_RPATH >= 2 */
 
 
 
@@ -2381,8 +3538,10 @@ static FRESULT dir_read (
 /* Directory handling - Find an object in the directory                  */
 /*-----------------------------------------------------------------------*/
 
-static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
-	DIR* dp					/* Pointer to the directory object with the file name */
+static FRESULT dir_scan (	/* FR_OK(0):succeeded, FR_NO_FILE:not found before the end or lim, !=0:error */
+	DIR* dp,				/* Pointer to the directory object with the file name, at the top of an entry block */
+	DWORD lim,				/* Stop at the first block boundary at or beyond this offset (index only) */
+	int rec					/* Add the entry blocks to the directory index (index only) */
 )
 {
 	FRESULT res;
@@ -2391,16 +3550,32 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 #if FF_USE_LFN
 	BYTE a, ord, sum;
 #endif
+#if FF_DIR_INDEX_SIZE
+	DWORD lofs = 0xFFFFFFFF, lh = 0;
+	BYTE lord = 0xFF, lsum = 0;
+	WORD sh;
+#else
+	(void)lim; (void)rec;	/* Used only with the directory index */
+#endif
 
-	res = dir_sdi(dp, 0);			/* Rewind directory object */
-	if (res != FR_OK) return res;
 #if FF_FS_EXFAT
 	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
 		BYTE nc;
 		UINT di, ni;
 		WORD hash = xname_sum(fs->lfnbuf);		/* Hash value of the name to find */
 
-		while ((res = DIR_READ_FILE(dp)) == FR_OK) {	/* Read an item */
+		for (;;) {
+#if FF_DIR_INDEX_SIZE
+			if (dp->dptr >= lim) {		/* Reached the limit? */
+				res = FR_NO_FILE; break;
+			}
+			if (rec) fs->dixend = dp->dptr;	/* Entry blocks before here are in the index */
+#endif
+			res = DIR_READ_FILE(dp);	/* Read an item */
+			if (res != FR_OK) break;
+#if FF_DIR_INDEX_SIZE
+			if (rec) rec = dix_put(fs, dp->blk_ofs, ld_word(fs->dirbuf + XDIR_NameHash), 0);
+#endif
 #if FF_MAX_LFN < 255
 			if (fs->dirbuf[XDIR_NumName] > FF_MAX_LFN) continue;		/* Skip comparison if inaccessible object name */
 #endif
@@ -2419,7 +3594,15 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 	ord = sum = 0xFF; dp->blk_ofs = 0xFFFFFFFF;	/* Reset LFN sequence */
 #endif
 	do {
-		res = move_window(fs, dp->sect);
+#if FF_DIR_INDEX_SIZE
+		if (lofs == 0xFFFFFFFF) {		/* At a boundary of entry blocks? */
+			if (dp->dptr >= lim) {		/* Reached the limit? */
+				res = FR_NO_FILE; break;
+			}
+			if (rec) fs->dixend = dp->dptr;	/* Entry blocks before here are in the index */
+		}
+#endif
+		res = move_dir_window(dp);
 		if (res != FR_OK) break;
 		c = dp->dir[DIR_Name];
 		if (c == 0) { res = FR_NO_FILE; break; }	/* Reached to end of table */
@@ -2427,8 +3610,23 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 		dp->obj.attr = a = dp->dir[DIR_Attr] & AM_MASK;
 		if (c == DDEM || ((a & AM_VOL) && a != AM_LFN)) {	/* An entry without valid data */
 			ord = 0xFF; dp->blk_ofs = 0xFFFFFFFF;	/* Reset LFN sequence */
+#if FF_DIR_INDEX_SIZE
+			lofs = 0xFFFFFFFF;
+#endif
 		} else {
 			if (a == AM_LFN) {			/* An LFN entry is found */
+#if FF_DIR_INDEX_SIZE
+				if (c & LLEF) {			/* Start of an entry block (regardless of the name to find) */
+					lofs = dp->dptr; lord = c & ~LLEF; lsum = dp->dir[LDIR_Chksum]; lh = 0;
+				}
+				if (rec) {				/* Hash the LFN as it goes */
+					if ((c & ~LLEF) == lord && dp->dir[LDIR_Chksum] == lsum) {
+						lh += dix_lfn(dp->dir); lord--;
+					} else {
+						lord = 0xFF;
+					}
+				}
+#endif
 				if (!(dp->fn[NSFLAG] & NS_NOLFN)) {
 					if (c & LLEF) {		/* Is it start of LFN sequence? */
 						sum = dp->dir[LDIR_Chksum];
@@ -2439,6 +3637,13 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 					ord = (c == ord && sum == dp->dir[LDIR_Chksum] && cmp_lfn(fs->lfnbuf, dp->dir)) ? ord - 1 : 0xFF;
 				}
 			} else {					/* An SFN entry is found */
+#if FF_DIR_INDEX_SIZE
+				if (rec) {
+					sh = dix_sfn(dp->dir);
+					rec = dix_put(fs, (lofs != 0xFFFFFFFF) ? lofs : dp->dptr, (lord == 0 && lsum == sum_sfn(dp->dir)) ? dix_fold(lh) : sh, sh);
+				}
+				lofs = 0xFFFFFFFF;
+#endif
 				if (ord == 0 && sum == sum_sfn(dp->dir)) break;	/* LFN matched? */
 				if (!(dp->fn[NSFLAG] & NS_LOSS) && !memcmp(dp->dir, dp->fn, 11)) break;	/* SFN matched? */
 				ord = 0xFF; dp->blk_ofs = 0xFFFFFFFF;	/* Reset LFN sequence */
@@ -2455,6 +3660,62 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 }
 
 
+static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
+	DIR* dp					/* Pointer to the directory object with the file name */
+)
+{
+	FRESULT res;
+#if FF_DIR_INDEX_SIZE
+	FATFS *fs = dp->obj.fs;
+	UINT i;
+	DWORD h;
+	WORD lh, sh;
+	BYTE lv, sv;
+#endif
+
+	res = dir_sdi(dp, 0);			/* Rewind directory object */
+	if (res != FR_OK) return res;
+#if FF_DIR_INDEX_SIZE
+	if (!fs->dixstat || fs->dixclst != dp->obj.sclust) {	/* Is the directory not indexed? */
+		res = dir_scan(dp, DIX_HEAD, 0);	/* Search the top of the directory */
+		if (res != FR_NO_FILE || dp->sect == 0 || dp->dptr < DIX_HEAD) return res;	/* Found, error or end of a small directory? */
+		fs->dixstat = 1; fs->dixclst = dp->obj.sclust; fs->dixn = 0;	/* Index this directory from here on */
+		fs->dixhead = fs->dixend = dp->dptr;
+	} else {
+		res = dir_scan(dp, fs->dixhead, 0);	/* Search the unindexed top of the directory */
+		if (res != FR_NO_FILE) return res;
+		lv = sv = 0; lh = sh = 0;
+#if FF_FS_EXFAT
+		if (fs->fs_type == FS_EXFAT) {
+			lh = xname_sum(fs->lfnbuf); lv = 1;
+		} else
+#endif
+		{
+			if (!(dp->fn[NSFLAG] & NS_NOLFN)) {	/* The name can match an LFN */
+				for (h = 0, i = 0; fs->lfnbuf[i]; i++) h += dix_term(ff_wtoupper(fs->lfnbuf[i]), i);
+				lh = dix_fold(h); lv = 1;
+			}
+			if (!(dp->fn[NSFLAG] & NS_LOSS)) {	/* The name can match an SFN */
+				sh = dix_sfn(dp->fn); sv = 1;
+			}
+		}
+		for (i = 0; i < fs->dixn; i++) {	/* Verify the entry blocks with a matching hash */
+			if ((lv && fs->dix[i].lhash == lh) || (sv && fs->dix[i].shash == sh)) {
+				res = dir_sdi(dp, fs->dix[i].ofs);
+				if (res == FR_OK) res = dir_scan(dp, fs->dix[i].ofs + 1, 0);
+				if (res != FR_NO_FILE) return res;
+			}
+		}
+		res = dir_sdi(dp, fs->dixend);		/* Search the rest of the directory */
+		if (res != FR_OK) return res;
+	}
+	return dir_scan(dp, 0xFFFFFFFF, 1);
+#else
+	return dir_scan(dp, 0xFFFFFFFF, 0);
+#endif
+}
+
+
 
 
 #if !FF_FS_READONLY
@@ -2500,10 +3761,16 @@ static FRESULT dir_register (	/* FR_OK:succeeded, FR_DENIED:no free entry or too
 				fs->dirbuf[XDIR_GenFlags] = dp->obj.stat | 1;		/* Update the allocation status */
 				res = store_xdir(&dj);				/* Store the object status */
 				if (res != FR_OK) return res;
+#if FF_PATH_CACHE
+				pcache_clear(fs);					/* Cached size of the directory is no longer valid */
+#endif
 			}
 		}
 
 		create_xdir(fs->dirbuf, fs->lfnbuf);	/* Create on-memory directory block to be written later */
+#if FF_DIR_INDEX_SIZE
+		dix_add(dp, dp->blk_ofs, ld_word(fs->dirbuf + XDIR_NameHash), 0);
+#endif
 		return FR_OK;
 	}
 #endif
@@ -2524,6 +3791,14 @@ static FRESULT dir_register (	/* FR_OK:succeeded, FR_DENIED:no free entry or too
 	/* Create an SFN with/without LFNs. */
 	n_ent = (sn[NSFLAG] & NS_LFN) ? (len + 12) / 13 + 1 : 1;	/* Number of entries to allocate */
 	res = dir_alloc(dp, n_ent);		/* Allocate entries */
+#if FF_DIR_INDEX_SIZE
+	if (res == FR_OK) {
+		DWORD h = 0;
+
+		for (n = 0; n < len; n++) h += dix_term(ff_wtoupper(fs->lfnbuf[n]), n);
+		dix_add(dp, dp->dptr - (n_ent - 1) * SZDIRE, (sn[NSFLAG] & NS_LFN) ? dix_fold(h) : dix_sfn(dp->fn), dix_sfn(dp->fn));
+	}
+#endif
 	if (res == FR_OK && --n_ent) {	/* Set LFN entry if needed */
 		res = dir_sdi(dp, dp->dptr - n_ent * SZDIRE);
 		if (res == FR_OK) {
@@ -2577,6 +3852,9 @@ static FRESULT dir_remove (	/* FR_OK:Succeeded, FR_DISK_ERR:A disk error */
 #if FF_USE_LFN		/* LFN configuration */
 	DWORD last = dp->dptr;
 
+#if FF_DIR_INDEX_SIZE
+	dix_remove(dp, (dp->blk_ofs == 0xFFFFFFFF) ? dp->dptr : dp->blk_ofs);
+#endif
 	res = (dp->blk_ofs == 0xFFFFFFFF) ? FR_OK : dir_sdi(dp, dp->blk_ofs);	/* Goto top of the entry block if LFN is exist */
 	if (res == FR_OK) {
 		do {
@@ -3056,6 +4334,11 @@ static FRESULT follow_path (	/* FR_OK(0): successful, !=0: error code */
 	FRESULT res;
 	BYTE ns;
 	FATFS *fs = dp->obj.fs;
+#if FF_PATH_CACHE
+	const TCHAR *top, *last;
+	DWORD base;
+	UINT len;
+#endif
 
 
 #if FF_FS_RPATH != 0
@@ -3089,6 +4372,12 @@ static FRESULT follow_path (	/* FR_OK(0): successful, !=0: error code */
 		res = dir_sdi(dp, 0);
 
 	} else {								/* Follow path */
+#if FF_PATH_CACHE
+		top = path; base = dp->obj.sclust;
+		last = pcache_split(path, &len);
+		if (len > FF_PATH_CACHE_LEN) len = 0;	/* Too long to be cached */
+		if (len > 0 && pcache_find(dp, path, len)) path = last;	/* Skip the directories already known */
+#endif
 		for (;;) {
 			res = create_name(dp, &path);	/* Get a segment name of the path */
 			if (res != FR_OK) break;
@@ -3122,6 +4411,9 @@ static FRESULT follow_path (	/* FR_OK(0): successful, !=0: error code */
 			{
 				dp->obj.sclust = ld_clust(fs, fs->win + dp->dptr % SS(fs));	/* Open next directory */
 			}
+#if FF_PATH_CACHE
+			if (len > 0 && path == last) pcache_put(dp, base, top, len);	/* Reached the last directory */
+#endif
 		}
 	}
 
@@ -3282,6 +4574,92 @@ static DWORD make_rand (
 
 
 
+#if FF_LAZY_SYNC && !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Lazy sync - Decide whether f_sync can leave the directory entry       */
+/*-----------------------------------------------------------------------*/
+
+static int lz_defer (	/* 0:Full sync is needed, 1:Deferred, 2:Deferred and the entry has been newly recorded */
+	FIL* fp			/* Pointer to the file object */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	UINT i;
+
+
+	if (!fp->lzmode || fs->fs_type != FS_FAT32 || (fs->fsi_flag & 0x80)) return 0;	/* Needs FSInfo to record the entry */
+	if (fp->obj.sclust == 0 || fp->obj.sclust != fp->lzsclust) return 0;	/* Start cluster on the entry is out of date? */
+	if (fp->obj.objsize < fp->lzsize || fp->obj.objsize - fp->lzsize >= FF_LAZY_SYNC_BYTES) return 0;	/* Shrunk or byte threshold reached? */
+	if (FF_LAZY_SYNC_MS && (DWORD)(ff_uptime_ms() - fp->lztime) >= FF_LAZY_SYNC_MS) return 0;	/* Time threshold reached? */
+	if (fp->lzslot != 0) return 1;	/* Already recorded */
+	for (i = 0; i < FF_LAZY_SYNC && fs->lzsect[i] != 0; i++) ;	/* Find a free record */
+	if (i == FF_LAZY_SYNC) return 0;
+	if (move_window(fs, fp->dir_sect) != FR_OK) return 0;	/* Load the entry to hash the name */
+	fs->lzsect[i] = (DWORD)(fp->dir_sect - fs->volbase);
+	fs->lzofs[i] = (WORD)(fp->dir_ptr - fs->win);
+	fs->lzclst[i] = fp->obj.sclust;
+	fs->lzhash[i] = lz_hash(fp->dir_ptr);
+	fp->lzslot = (BYTE)(i + 1);
+	fs->fsi_flag |= 1;
+	return 2;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/* Lazy sync - Recover the size of files left in lazy sync               */
+/*-----------------------------------------------------------------------*/
+/* A file whose cluster chain is longer than its size gets the size of the
+/  chain. The data after the last record written is undefined. Recovery
+/  writes to the volume, so it waits for the first access with write mode. */
+
+static FRESULT lz_recover (
+	FATFS* fs		/* Filesystem object (mounted, with records loaded from FSInfo) */
+)
+{
+	FRESULT res = FR_OK;
+	FFOBJID obj;
+	UINT i;
+	DWORD clst, ncl, csz;
+	BYTE *dir;
+
+
+	obj.fs = fs;
+	for (i = 0; i < FF_LAZY_SYNC; i++) {
+		if (fs->lzsect[i] == 0) continue;
+		if (fs->lzofs[i] % SZDIRE == 0 && fs->lzofs[i] < SS(fs)
+			&& (res = move_window(fs, fs->volbase + fs->lzsect[i])) == FR_OK)
+		{
+			dir = fs->win + fs->lzofs[i];
+			if (dir[DIR_Name] != DDEM && dir[DIR_Name] != 0 && !(dir[DIR_Attr] & (AM_DIR | AM_VOL))	/* Is it still the same file? */
+				&& ld_clust(fs, dir) == fs->lzclst[i] && lz_hash(dir) == fs->lzhash[i])
+			{
+				clst = ld_clust(fs, dir);
+				for (ncl = 0; clst >= 2 && clst < fs->n_fatent && ncl < fs->n_fatent; ncl++) {	/* Count the chain (win[] is used for the FAT) */
+					clst = get_fat(&obj, clst);
+				}
+				if (clst == 0xFFFFFFFF) res = FR_DISK_ERR;
+				csz = (DWORD)fs->csize * SS(fs);		/* Size of the chain */
+				csz = (ncl > 0xFFFFFFFF / csz) ? 0xFFFFFFFF : ncl * csz;
+				if (res == FR_OK) res = move_window(fs, fs->volbase + fs->lzsect[i]);	/* Reload the entry */
+				if (res == FR_OK && csz > ld_dword(dir + DIR_FileSize)) {
+					st_dword(dir + DIR_FileSize, csz);
+					fs->wflag = 1;
+				}
+			}
+		}
+		if (res != FR_OK) return res;
+		fs->lzsect[i] = 0;
+	}
+	fs->lzpend = 0;
+	fs->free_clst = 0xFFFFFFFF;	/* Free cluster count in FSInfo was not kept up to date */
+	fs->fsi_flag |= 1;
+	return sync_fs(fs);
+}
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Load a sector and check if it is an FAT VBR                           */
 /*-----------------------------------------------------------------------*/
@@ -3298,6 +4676,11 @@ static UINT check_fs (	/* 0:FAT/FAT32 VBR, 1:exFAT VBR, 2:Not FAT and valid BS,
 
 
 	fs->wflag = 0; fs->winsect = (LBA_t)0 - 1;		/* Invaidate window */
+#if FF_FAT_CACHE_SECTORS
+	for (b = 0; b < FC_PARTS; b++) {	/* Invalidate FAT cache */
+		fs->fcn[b] = 0; fs->fcdlo[b] = FF_FAT_CACHE_SECTORS; fs->fcdhi[b] = 0;
+	}
+#endif
 	if (move_window(fs, sect) != FR_OK) return 4;	/* Load the boot sector */
 	sign = ld_word(fs->win + BS_55AA);
 #if FF_FS_EXFAT
@@ -3395,6 +4778,10 @@ static FRESULT mount_volume (	/* FR_OK(0): successful, !=0: an error occurred */
 	DWORD tsect, sysect, fasize, nclst, szbfat;
 	WORD nrsv;
 	UINT fmt;
+#if FF_LAZY_SYNC && !FF_FS_READONLY
+	UINT nlz;
+	FRESULT res;
+#endif
 
 
 	/* Get logical drive number */
@@ -3417,6 +4804,12 @@ static FRESULT mount_volume (	/* FR_OK(0): successful, !=0: an error occurred */
 			if (!FF_FS_READONLY && mode && (stat & STA_PROTECT)) {	/* Check write protection if needed */
 				return FR_WRITE_PROTECTED;
 			}
+#if FF_LAZY_SYNC && !FF_FS_READONLY
+			if (mode && fs->lzpend) {	/* First write access since the files left in lazy sync were found? */
+				res = lz_recover(fs);
+				if (res != FR_OK) return res;
+			}
+#endif
 			return FR_OK;				/* The filesystem object is already valid */
 		}
 	}
@@ -3442,6 +4835,10 @@ static FRESULT mount_volume (	/* FR_OK(0): successful, !=0: an error occurred */
 	if (fmt == 4) return FR_DISK_ERR;		/* An error occurred in the disk I/O layer */
 	if (fmt >= 2) return FR_NO_FILESYSTEM;	/* No FAT volume is found */
 	bsect = fs->winsect;					/* Volume offset in the hosting physical drive */
+#if FF_LAZY_SYNC && !FF_FS_READONLY
+	memset(fs->lzsect, 0, sizeof fs->lzsect);	/* No lazy sync record */
+	fs->lzpend = 0;
+#endif
 
 	/* An FAT volume is found (bsect). Following code initializes the filesystem object */
 
@@ -3564,6 +4961,9 @@ static FRESULT mount_volume (	/* FR_OK(0): successful, !=0: an error occurred */
 		/* Get FSInfo if available */
 		fs->last_clst = fs->free_clst = 0xFFFFFFFF;		/* Initialize cluster allocation information */
 		fs->fsi_flag = 0x80;
+#if FF_FREE_MAP_BYTES
+		fmap_init(fs, 0xFF);	/* Nothing is known about free clusters yet */
+#endif
 #if (FF_FS_NOFSINFO & 3) != 3
 		if (fmt == FS_FAT32				/* Allow to update FSInfo only if BPB_FSInfo32 == 1 */
 			&& ld_word(fs->win + BPB_FSInfo32) == 1
@@ -3579,6 +4979,18 @@ static FRESULT mount_volume (	/* FR_OK(0): successful, !=0: an error occurred */
 #endif
 #if (FF_FS_NOFSINFO & 2) == 0
 				fs->last_clst = ld_dword(fs->win + FSI_Nxt_Free);
+#endif
+#if FF_LAZY_SYNC
+				nlz = ld_dword(fs->win + FSI_LzSig) - 0x4D5A5943;	/* Number of lazy sync records */
+				if (nlz != 0 && nlz <= FF_LAZY_SYNC) {
+					fs->lzpend = 1;		/* Recover the files on the first write access */
+					while (nlz-- > 0) {
+						fs->lzsect[nlz] = ld_dword(fs->win + FSI_LzRec + nlz * SZ_LZREC);
+						fs->lzclst[nlz] = ld_dword(fs->win + FSI_LzRec + nlz * SZ_LZREC + 4);
+						fs->lzofs[nlz] = ld_word(fs->win + FSI_LzRec + nlz * SZ_LZREC + 8);
+						fs->lzhash[nlz] = ld_word(fs->win + FSI_LzRec + nlz * SZ_LZREC + 10);
+					}
+				}
 #endif
 			}
 		}
@@ -3586,8 +4998,43 @@ static FRESULT mount_volume (	/* FR_OK(0): successful, !=0: an error occurred */
 #endif	/* !FF_FS_READONLY */
 	}
 
+#if !FF_FS_READONLY
+	fs->gf_clst = 0;		/* No free cluster scan in progress */
+#if FF_PREALLOC_CLUSTERS
+	fs->pa_au = 0;			/* Allocation unit of the media is not known yet */
+	fs->pa_fail = 0;
+#endif
+#if FF_BATCH_FREE
+	fs->bf_on = 0; fs->bf_n = 0;	/* Chains are freed at once */
+#endif
+#endif
+#if FF_FILE_BUFFERS
+	memset(fs->fbown, 0, sizeof fs->fbown);	/* All file buffers are free */
+	fs->fbtick = 0;
+#endif
+#if FF_DIR_INDEX_SIZE
+	fs->dixstat = 0;		/* No directory is indexed */
+#endif
+#if FF_DIR_READAHEAD
+	fs->dran = 0;			/* Nothing is read ahead */
+#endif
+#if FF_PATH_CACHE
+	pcache_clear(fs);		/* No path is known */
+#endif
+#if FF_USE_FASTSEEK && FF_AUTO_CLMT
+	memset(fs->clmtuse, 0, sizeof fs->clmtuse);	/* Automatic CLMT pool is free */
+#endif
 	fs->fs_type = (BYTE)fmt;/* FAT sub-type (the filesystem object gets valid) */
 	fs->id = ++Fsid;		/* Volume mount ID */
+#if FF_LAZY_SYNC && !FF_FS_READONLY
+	if (mode && fs->lzpend) {	/* Files were left in lazy sync? (recovered now only with write access) */
+		res = lz_recover(fs);
+		if (res != FR_OK) {
+			fs->fs_type = 0;	/* Leave the volume unmounted */
+			return res;
+		}
+	}
+#endif
 #if FF_USE_LFN == 1
 	fs->lfnbuf = LfnBuf;	/* Static LFN working buffer */
 #if FF_FS_EXFAT
@@ -3676,6 +5123,9 @@ FRESULT f_mount (
 #if FF_FS_LOCK
 		clear_share(cfs);
 #endif
+#if FF_USE_FASTSEEK && FF_AUTO_CLMT
+		memset(cfs->clmtuse, 0, sizeof cfs->clmtuse);	/* Return the automatic maps of files left open to the pool */
+#endif
 #if FF_FS_REENTRANT				/* Discard mutex of the current volume */
 		ff_mutex_delete(vol);
 #endif
@@ -3857,6 +5307,20 @@ FRESULT f_open (
 			}
 #if FF_USE_FASTSEEK
 			fp->cltbl = 0;		/* Disable fast seek mode */
+#if FF_AUTO_CLMT
+			fp->clmtslot = 0;	/* No automatic map yet */
+#endif
+#endif
+#if !FF_FS_READONLY && FF_PREALLOC_CLUSTERS
+			fp->pa_size = (mode & FA_WRITE) ? FF_PREALLOC_CLUSTERS : 0;	/* Default preallocation policy */
+			fp->pa_ncl = 0;		/* Nothing reserved yet */
+#endif
+#if !FF_FS_READONLY && FF_LAZY_SYNC
+			fp->lzmode = 1;		/* f_sync may defer the directory entry update */
+			fp->lzslot = 0;
+			fp->lzsclust = fp->obj.sclust;	/* The entry on the disk */
+			fp->lzsize = fp->obj.objsize;
+			fp->lztime = ff_uptime_ms();
 #endif
 			fp->obj.fs = fs;	/* Validate the file object */
 			fp->obj.id = fs->id;
@@ -3864,8 +5328,11 @@ FRESULT f_open (
 			fp->err = 0;		/* Clear error flag */
 			fp->sect = 0;		/* Invalidate current data sector */
 			fp->fptr = 0;		/* Set file pointer top of the file */
+#if FF_FILE_BUFFERS
+			fp->buf = 0;		/* No buffer is borrowed yet */
+#endif
 #if !FF_FS_READONLY
-#if !FF_FS_TINY
+#if !FF_FS_TINY && !FF_FILE_BUFFERS
 			memset(fp->buf, 0, sizeof fp->buf);	/* Clear sector buffer */
 #endif
 			if ((mode & FA_SEEKEND) && fp->obj.objsize > 0) {	/* Seek to end of file if FA_OPEN_APPEND is specified */
@@ -3884,7 +5351,9 @@ FRESULT f_open (
 						res = FR_INT_ERR;
 					} else {
 						fp->sect = sc + (DWORD)(ofs / SS(fs));
-#if !FF_FS_TINY
+#if FF_FILE_BUFFERS
+						res = fbuf_bind(fp, 1);	/* Borrow a buffer and load the sector */
+#elif !FF_FS_TINY
 						if (disk_read(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) res = FR_DISK_ERR;
 #endif
 					}
@@ -3933,6 +5402,7 @@ FRESULT f_read (
 	if (!(fp->flag & FA_READ)) LEAVE_FF(fs, FR_DENIED); /* Check access mode */
 	remain = fp->obj.objsize - fp->fptr;
 	if (btr > remain) btr = (UINT)remain;		/* Truncate btr by remaining bytes */
+	if (btr > 0 && (res = fbuf_bind(fp, 1)) != FR_OK) LEAVE_FF(fs, res);	/* Get the sector buffer */
 
 	for ( ; btr > 0; btr -= rcnt, *br += rcnt, rbuff += rcnt, fp->fptr += rcnt) {	/* Repeat until btr bytes read */
 		if (fp->fptr % SS(fs) == 0) {			/* On the sector boundary? */
@@ -4030,6 +5500,7 @@ FRESULT f_write (
 	res = validate(&fp->obj, &fs);			/* Check validity of the file object */
 	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);	/* Check validity */
 	if (!(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);	/* Check access mode */
+	if (btw > 0 && (res = fbuf_bind(fp, 1)) != FR_OK) LEAVE_FF(fs, res);	/* Get the sector buffer */
 
 	/* Check fptr wrap-around (file size cannot reach 4 GiB at FAT volume) */
 	if ((!FF_FS_EXFAT || fs->fs_type != FS_EXFAT) && (DWORD)(fp->fptr + btw) < (DWORD)fp->fptr) {
@@ -4043,16 +5514,22 @@ FRESULT f_write (
 				if (fp->fptr == 0) {		/* On the top of the file? */
 					clst = fp->obj.sclust;	/* Follow from the origin */
 					if (clst == 0) {		/* If no cluster is allocated, */
-						clst = create_chain(&fp->obj, 0);	/* create a new cluster chain */
+						clst = stretch_file(fp, 0);	/* create a new cluster chain */
 					}
 				} else {					/* On the middle or end of the file */
 #if FF_USE_FASTSEEK
 					if (fp->cltbl) {
 						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the CLMT */
+#if FF_AUTO_CLMT
+						if (clst == 0 && clmt_owned(fp)) {	/* Beyond the end of the automatic map? */
+							clst = stretch_file(fp, fp->clust);	/* Stretch the chain */
+							if (clst >= 2 && clst != 0xFFFFFFFF) clmt_append(fp, clst);	/* and map the new cluster */
+						}
+#endif
 					} else
 #endif
 					{
-						clst = create_chain(&fp->obj, fp->clust);	/* Follow or stretch cluster chain on the FAT */
+						clst = stretch_file(fp, fp->clust);	/* Follow or stretch cluster chain on the FAT */
 					}
 				}
 				if (clst == 0) break;		/* Could not allocate a new cluster (disk full) */
@@ -4150,6 +5627,18 @@ FRESULT f_sync (
 				if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) LEAVE_FF(fs, FR_DISK_ERR);
 				fp->flag &= (BYTE)~FA_DIRTY;
 			}
+#endif
+#if FF_LAZY_SYNC
+			switch (lz_defer(fp)) {		/* Can the directory entry be left out of date for now? */
+			case 2:						/* Record the entry in FSInfo first */
+				res = sync_fs(fs);
+				LEAVE_FF(fs, res);
+			case 1:						/* Flush the data and the FAT only */
+				res = sync_fat_cache(fs);
+				if (res == FR_OK) res = sync_window(fs);
+				if (res == FR_OK && disk_ioctl(fs->pdrv, CTRL_SYNC, 0) != RES_OK) res = FR_DISK_ERR;
+				LEAVE_FF(fs, res);
+			}
 #endif
 			/* Update the directory entry */
 			tm = GET_FATTIME();				/* Modified time */
@@ -4194,6 +5683,16 @@ FRESULT f_sync (
 					st_dword(dir + DIR_ModTime, tm);				/* Update modified time */
 					st_word(dir + DIR_LstAccDate, 0);
 					fs->wflag = 1;
+#if FF_LAZY_SYNC
+					if (fp->lzslot != 0) {		/* Remove the lazy sync record */
+						fs->lzsect[fp->lzslot - 1] = 0;
+						fp->lzslot = 0;
+						fs->fsi_flag |= 1;
+					}
+					fp->lzsclust = fp->obj.sclust;	/* The entry is up to date */
+					fp->lzsize = fp->obj.objsize;
+					fp->lztime = ff_uptime_ms();
+#endif
 					res = sync_fs(fs);					/* Restore it to the directory */
 					fp->flag &= (BYTE)~FA_MODIFIED;
 				}
@@ -4221,12 +5720,26 @@ FRESULT f_close (
 	FATFS *fs;
 
 #if !FF_FS_READONLY
+#if FF_LAZY_SYNC
+	fp->lzmode = 0;						/* Bring the directory entry up to date */
+#endif
 	res = f_sync(fp);					/* Flush cached data */
 	if (res == FR_OK)
 #endif
 	{
 		res = validate(&fp->obj, &fs);	/* Lock volume */
 		if (res == FR_OK) {
+#if !FF_FS_READONLY && FF_PREALLOC_CLUSTERS
+			if (fp->pa_ncl != 0) {			/* Return the unused reservation to the volume */
+				res = pa_trim(fp);
+				if (res == FR_OK) res = sync_fs(fs);
+				if (res != FR_OK) LEAVE_FF(fs, res);
+			}
+#endif
+#if FF_USE_FASTSEEK && FF_AUTO_CLMT
+			clmt_release(fp);				/* Return the automatic map to the pool */
+#endif
+			fbuf_release(fp);				/* Return the sector buffer to the pool */
 #if FF_FS_LOCK
 			res = dec_share(fp->obj.lockid);		/* Decrement file open counter */
 			if (res == FR_OK) fp->obj.fs = 0;	/* Invalidate file object */
@@ -4441,8 +5954,6 @@ FRESULT f_lseek (
 	LBA_t nsect;
 	FSIZE_t ifptr;
 #if FF_USE_FASTSEEK
-	DWORD cl, pcl, ncl, tcl, tlen, ulen;
-	DWORD *tbl;
 	LBA_t dsc;
 #endif
 
@@ -4456,32 +5967,26 @@ FRESULT f_lseek (
 	if (res != FR_OK) LEAVE_FF(fs, res);
 
 #if FF_USE_FASTSEEK
-	if (fp->cltbl) {	/* Fast seek */
-		if (ofs == CREATE_LINKMAP) {	/* Create CLMT */
-			tbl = fp->cltbl;
-			tlen = *tbl++; ulen = 2;	/* Given table size and required table size */
-			cl = fp->obj.sclust;		/* Origin of the chain */
-			if (cl != 0) {
-				do {
-					/* Get a fragment */
-					tcl = cl; ncl = 0; ulen += 2;	/* Top, length and used items */
-					do {
-						pcl = cl; ncl++;
-						cl = get_fat(&fp->obj, cl);
-						if (cl <= 1) ABORT(fs, FR_INT_ERR);
-						if (cl == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
-					} while (cl == pcl + 1);
-					if (ulen <= tlen) {		/* Store the length and top of the fragment */
-						*tbl++ = ncl; *tbl++ = tcl;
-					}
-				} while (cl < fs->n_fatent);	/* Repeat until end of chain */
-			}
-			*fp->cltbl = ulen;	/* Number of items used */
-			if (ulen <= tlen) {
-				*tbl = 0;		/* Terminate table */
-			} else {
-				res = FR_NOT_ENOUGH_CORE;	/* Given table size is smaller than required */
+#if FF_AUTO_CLMT
+	if (ofs != CREATE_LINKMAP) {
+		if (clmt_owned(fp)) {
+			if (!FF_FS_READONLY && ofs > fp->obj.objsize && (fp->flag & FA_WRITE)) clmt_release(fp);	/* Let normal seek stretch the chain */
+		} else {
+			if (!fp->cltbl && fp->clmtslot != 0xFF && fp->obj.objsize > (FSIZE_t)fs->csize * SS(fs)	/* A random seek in a file of more than a cluster? */
+				&& ofs != fp->fptr && ofs != fp->obj.objsize) {
+				if (fp->clmtslot == 0) {
+					fp->clmtslot = 0xFE;	/* Map it on the next one */
+				} else {
+					clmt_auto(fp);
+				}
 			}
+		}
+	}
+#endif
+	if (fp->cltbl) {	/* Fast seek */
+		if (ofs == CREATE_LINKMAP) {	/* Create CLMT */
+			res = clmt_create(fp, 1);
+			if (res != FR_OK && res != FR_NOT_ENOUGH_CORE) ABORT(fs, res);
 		} else {						/* Fast seek */
 			if (ofs > fp->obj.objsize) ofs = fp->obj.objsize;	/* Clip offset at the file size */
 			fp->fptr = ofs;				/* Set file pointer */
@@ -4498,6 +6003,10 @@ FRESULT f_lseek (
 						fp->flag &= (BYTE)~FA_DIRTY;
 					}
 #endif
+					if ((res = fbuf_bind(fp, 0)) != FR_OK) {	/* Get the sector buffer */
+						fp->sect = dsc;			/* Loaded on the next access */
+						LEAVE_FF(fs, res);
+					}
 					if (disk_read(fs->pdrv, fp->buf, dsc, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);	/* Load current sector */
 #endif
 					fp->sect = dsc;
@@ -4528,7 +6037,7 @@ FRESULT f_lseek (
 				clst = fp->obj.sclust;					/* start from the first cluster */
 #if !FF_FS_READONLY
 				if (clst == 0) {						/* If no cluster chain, create a new chain */
-					clst = create_chain(&fp->obj, 0);
+					clst = stretch_file(fp, 0);
 					if (clst == 1) ABORT(fs, FR_INT_ERR);
 					if (clst == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
 					fp->obj.sclust = clst;
@@ -4545,7 +6054,7 @@ FRESULT f_lseek (
 							fp->obj.objsize = fp->fptr;
 							fp->flag |= FA_MODIFIED;
 						}
-						clst = create_chain(&fp->obj, clst);	/* Follow chain with forceed stretch */
+						clst = stretch_file(fp, clst);	/* Follow chain with forceed stretch */
 						if (clst == 0) {				/* Clip file size in case of disk full */
 							ofs = 0; break;
 						}
@@ -4578,6 +6087,10 @@ FRESULT f_lseek (
 				fp->flag &= (BYTE)~FA_DIRTY;
 			}
 #endif
+			if ((res = fbuf_bind(fp, 0)) != FR_OK) {	/* Get the sector buffer */
+				fp->sect = nsect;			/* Loaded on the next access */
+				LEAVE_FF(fs, res);
+			}
 			if (disk_read(fs->pdrv, fp->buf, nsect, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);	/* Fill sector cache */
 #endif
 			fp->sect = nsect;
@@ -4813,6 +6326,120 @@ FRESULT f_stat (
 /* Get Number of Free Clusters                                           */
 /*-----------------------------------------------------------------------*/
 
+#if FF_FS_EXFAT
+static UINT popcnt32 (	/* Number of bits set */
+	DWORD v
+)
+{
+	v = v - ((v >> 1) & 0x55555555);
+	v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
+	return (UINT)((((v + (v >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24);
+}
+#endif
+
+
+static FRESULT gf_scan (	/* FR_OK(0):succeeded, !=0:error */
+	FATFS* fs,		/* Filesystem object */
+	UINT nsect		/* Number of FAT/bitmap sectors to scan (0:to the end) */
+)
+{
+	FRESULT res = FR_OK;
+	DWORD clst, lim, stat, nfree;
+	UINT i, eps;
+	const BYTE *w;
+	FFOBJID obj;
+#if FF_FS_EXFAT
+	DWORD n, v;
+#endif
+#if FF_FREE_MAP_BYTES
+	int gfree = 0;
+#endif
+
+
+	if (fs->gf_clst == 0) {		/* Start a new scan */
+		fs->gf_clst = 2; fs->gf_nfree = 0;
+	}
+	clst = fs->gf_clst; nfree = fs->gf_nfree;
+
+	if (fs->fs_type == FS_FAT12) {	/* FAT12: Scan bit field FAT entries (small enough to do in one go) */
+		obj.fs = fs;
+		do {
+			stat = get_fat(&obj, clst);
+			if (stat == 0xFFFFFFFF) {
+				res = FR_DISK_ERR; break;
+			}
+			if (stat == 1) {
+				res = FR_INT_ERR; break;
+			}
+			if (stat == 0) nfree++;
+#if FF_FREE_MAP_BYTES
+			if (stat == 0) gfree = 1;
+			if (clst == fmap_last(fs, clst)) {	/* End of a group? */
+				fmap_put(fs, clst, gfree); gfree = 0;
+			}
+#endif
+		} while (++clst < fs->n_fatent);
+	} else {
+#if FF_FS_EXFAT
+		if (fs->fs_type == FS_EXFAT) {	/* exFAT: Scan allocation bitmap a word at a time */
+			eps = SS(fs) * 8;				/* Clusters per bitmap sector */
+			n = fs->n_fatent - 2;			/* Number of bits */
+			lim = (nsect == 0 || nsect > n / eps + 1) ? n : (clst - 2 + (DWORD)nsect * eps);
+			if (lim > n) lim = n;
+			for (v = clst - 2; v < lim; v += eps) {	/* v: bit index (always at top of a sector) */
+				w = fat_window(fs, fs->bitbase + v / eps);
+				if (w == 0) {
+					res = FR_DISK_ERR; break;
+				}
+				for (i = 0; i < SS(fs) && v + i * 8 < n; i += 4) {
+					stat = ld_dword(w + i);
+					if (n - (v + i * 8) < 32) stat |= 0xFFFFFFFF << (n - (v + i * 8));	/* Mask out bits beyond the last cluster */
+					nfree += 32 - popcnt32(stat);
+				}
+			}
+			if (res == FR_OK) clst = (v < lim ? v : lim) + 2;
+		} else
+#endif
+		{	/* FAT16/32: Scan WORD/DWORD FAT entries */
+			eps = SS(fs) / ((fs->fs_type == FS_FAT16) ? 2 : 4);	/* Entries per FAT sector */
+			lim = (nsect == 0 || nsect > fs->n_fatent / eps + 1) ? fs->n_fatent : (clst / eps + nsect) * eps;
+#if FF_FREE_MAP_BYTES
+			lim = ((lim - 1) | (((DWORD)1 << fs->fmshift) - 1)) + 1;	/* Finish the last group, so that every group is scanned in one go */
+#endif
+			if (lim > fs->n_fatent) lim = fs->n_fatent;
+			while (clst < lim) {
+				w = fat_window(fs, fs->fatbase + clst / eps);
+				if (w == 0) {
+					res = FR_DISK_ERR; break;
+				}
+				i = clst % eps;
+				do {	/* Count entries with zero in this sector */
+					stat = (fs->fs_type == FS_FAT16) ? ld_word(w + i * 2) : (ld_dword(w + i * 4) & 0x0FFFFFFF);
+					if (stat == 0) nfree++;
+#if FF_FREE_MAP_BYTES
+					if (stat == 0) gfree = 1;
+					if (clst == fmap_last(fs, clst)) {	/* End of a group? */
+						fmap_put(fs, clst, gfree); gfree = 0;
+					}
+#endif
+					clst++;
+				} while (clst < lim && ++i < eps);
+			}
+		}
+	}
+	if (res != FR_OK) {
+		fs->gf_clst = 0;	/* Start over next time */
+	} else if (clst >= fs->n_fatent) {	/* Scan completed? */
+		fs->gf_clst = 0;
+		fs->free_clst = nfree;	/* Now free_clst is valid */
+		fs->fsi_flag |= 1;		/* FAT32: FSInfo is to be updated */
+	} else {
+		fs->gf_clst = clst; fs->gf_nfree = nfree;
+	}
+	return res;
+}
+
+
 FRESULT f_getfree (
 	const TCHAR* path,	/* Logical drive number */
 	DWORD* nclst,		/* Pointer to a variable to return number of free clusters */
@@ -4821,80 +6448,41 @@ FRESULT f_getfree (
 {
 	FRESULT res;
 	FATFS *fs;
-	DWORD nfree, clst, stat;
-	LBA_t sect;
-	UINT i;
-	FFOBJID obj;
 
 
 	/* Get logical drive */
 	res = mount_volume(&path, &fs, 0);
 	if (res == FR_OK) {
 		*fatfs = fs;				/* Return ptr to the fs object */
-		/* If free_clst is valid, return it without full FAT scan */
-		if (fs->free_clst <= fs->n_fatent - 2) {
-			*nclst = fs->free_clst;
-		} else {
-			/* Scan FAT to obtain number of free clusters */
-			nfree = 0;
-			if (fs->fs_type == FS_FAT12) {	/* FAT12: Scan bit field FAT entries */
-				clst = 2; obj.fs = fs;
-				do {
-					stat = get_fat(&obj, clst);
-					if (stat == 0xFFFFFFFF) {
-						res = FR_DISK_ERR; break;
-					}
-					if (stat == 1) {
-						res = FR_INT_ERR; break;
-					}
-					if (stat == 0) nfree++;
-				} while (++clst < fs->n_fatent);
+		/* If free_clst is not valid, scan FAT (the rest of it, if a scan is in progress) */
+		if (fs->free_clst > fs->n_fatent - 2) res = gf_scan(fs, 0);
+		if (res == FR_OK) *nclst = fs->free_clst;
+	}
+
+	LEAVE_FF(fs, res);
+}
+
+
+FRESULT f_getfree_step (
+	const TCHAR* path,	/* Logical drive number */
+	DWORD* nclst,		/* Pointer to a variable to return number of free clusters (a lower bound until done) */
+	UINT nsect,			/* Number of FAT/bitmap sectors to scan in this call */
+	BYTE* done			/* Pointer to a variable to return 1 if *nclst is exact, 0 if the scan is in progress */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+
+
+	*done = 0;
+	res = mount_volume(&path, &fs, 0);
+	if (res == FR_OK) {
+		if (fs->free_clst > fs->n_fatent - 2) res = gf_scan(fs, nsect ? nsect : 1);	/* Scan a slice of FAT */
+		if (res == FR_OK) {
+			if (fs->free_clst <= fs->n_fatent - 2) {	/* Is free_clst valid? */
+				*nclst = fs->free_clst; *done = 1;
 			} else {
-#if FF_FS_EXFAT
-				if (fs->fs_type == FS_EXFAT) {	/* exFAT: Scan allocation bitmap */
-					BYTE bm;
-					UINT b;
-
-					clst = fs->n_fatent - 2;	/* Number of clusters */
-					sect = fs->bitbase;			/* Bitmap sector */
-					i = 0;						/* Offset in the sector */
-					do {	/* Counts numbuer of bits with zero in the bitmap */
-						if (i == 0) {	/* New sector? */
-							res = move_window(fs, sect++);
-							if (res != FR_OK) break;
-						}
-						for (b = 8, bm = ~fs->win[i]; b && clst; b--, clst--) {
-							nfree += bm & 1;
-							bm >>= 1;
-						}
-						i = (i + 1) % SS(fs);
-					} while (clst);
-				} else
-#endif
-				{	/* FAT16/32: Scan WORD/DWORD FAT entries */
-					clst = fs->n_fatent;	/* Number of entries */
-					sect = fs->fatbase;		/* Top of the FAT */
-					i = 0;					/* Offset in the sector */
-					do {	/* Counts numbuer of entries with zero in the FAT */
-						if (i == 0) {	/* New sector? */
-							res = move_window(fs, sect++);
-							if (res != FR_OK) break;
-						}
-						if (fs->fs_type == FS_FAT16) {
-							if (ld_word(fs->win + i) == 0) nfree++;
-							i += 2;
-						} else {
-							if ((ld_dword(fs->win + i) & 0x0FFFFFFF) == 0) nfree++;
-							i += 4;
-						}
-						i %= SS(fs);
-					} while (--clst);
-				}
-			}
-			if (res == FR_OK) {		/* Update parameters if succeeded */
-				*nclst = nfree;			/* Return the free clusters */
-				fs->free_clst = nfree;	/* Now free_clst is valid */
-				fs->fsi_flag |= 1;		/* FAT32: FSInfo is to be updated */
+				*nclst = fs->gf_nfree;	/* Free clusters found so far */
 			}
 		}
 	}
@@ -4921,8 +6509,15 @@ FRESULT f_truncate (
 	res = validate(&fp->obj, &fs);	/* Check validity of the file object */
 	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);
 	if (!(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);	/* Check access mode */
+#if FF_PREALLOC_CLUSTERS
+	res = pa_trim(fp);					/* Return the unused reservation to the volume */
+	if (res != FR_OK) ABORT(fs, res);
+#endif
 
 	if (fp->fptr < fp->obj.objsize) {	/* Process when fptr is not on the eof */
+#if FF_USE_FASTSEEK && FF_AUTO_CLMT
+		clmt_release(fp);		/* The automatic map would refer to removed clusters */
+#endif
 		if (fp->fptr == 0) {	/* When set file size to zero, remove entire cluster chain */
 			res = remove_chain(&fp->obj, fp->obj.sclust, 0);
 			fp->obj.sclust = 0;
@@ -5030,6 +6625,12 @@ FRESULT f_unlink (
 			}
 			if (res == FR_OK) {
 				res = dir_remove(&dj);			/* Remove the directory entry */
+#if FF_DIR_INDEX_SIZE
+				if (dclst != 0 && fs->dixstat && fs->dixclst == dclst) fs->dixstat = 0;	/* Drop the index of the removed directory */
+#endif
+#if FF_PATH_CACHE
+				if (dj.obj.attr & AM_DIR) pcache_clear(fs);	/* A cached path may lead to the removed directory */
+#endif
 				if (res == FR_OK && dclst != 0) {	/* Remove the cluster chain if exist */
 #if FF_FS_EXFAT
 					res = remove_chain(&obj, dclst, 0);
@@ -5163,6 +6764,9 @@ FRESULT f_rename (
 		}
 #endif
 		if (res == FR_OK) {					/* Object to be renamed is found */
+#if FF_PATH_CACHE
+			if (djo.obj.attr & AM_DIR) pcache_clear(fs);	/* A cached path may lead to the directory */
+#endif
 #if FF_FS_EXFAT
 			if (fs->fs_type == FS_EXFAT) {	/* At exFAT volume */
 				BYTE nf, nn;
@@ -5602,6 +7206,21 @@ FRESULT f_expand (
 	{
 		scl = clst = stcl; ncl = 0;
 		for (;;) {	/* Find a contiguous cluster block */
+#if FF_FREE_MAP_BYTES
+			if (!fmap_test(fs, clst)) {	/* Skip a group with no free cluster */
+				n = fmap_last(fs, clst);
+				if (stcl > clst && stcl <= n) {	/* No contiguous cluster? */
+					res = FR_DENIED; break;
+				}
+				clst = n + 1;
+				if (clst >= fs->n_fatent) clst = 2;
+				scl = clst; ncl = 0;
+				if (clst == stcl) {	/* No contiguous cluster? */
+					res = FR_DENIED; break;
+				}
+				continue;
+			}
+#endif
 			n = get_fat(&fp->obj, clst);
 			if (++clst >= fs->n_fatent) clst = 2;
 			if (n == 1) {
@@ -5643,6 +7262,7 @@ FRESULT f_expand (
 				fs->free_clst -= tcl;
 				fs->fsi_flag |= 1;
 			}
+			gf_track(fs, scl, tcl, 0);
 		}
 	}
 
@@ -5653,6 +7273,68 @@ FRESULT f_expand (
 
 
 
+
+#if FF_PREALLOC_CLUSTERS && !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Set the Preallocation Policy of a File                                */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_prealloc (
+	FIL* fp,		/* Pointer to the file object */
+	DWORD ncl		/* Number of clusters to reserve at a time as the file grows (0:Disable) */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+
+
+	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
+	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) LEAVE_FF(fs, res);
+	if (!(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);
+
+	res = pa_trim(fp);		/* Return the current reservation */
+	if (res != FR_OK) ABORT(fs, res);
+	fp->pa_size = ncl;
+
+	LEAVE_FF(fs, FR_OK);
+}
+
+#endif /* FF_PREALLOC_CLUSTERS && !FF_FS_READONLY */
+
+
+
+
+#if FF_BATCH_FREE && !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Start or Finish Batched Freeing of Clusters                           */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_batchfree (
+	const TCHAR* path,	/* Logical drive number */
+	BYTE opt			/* 1:Start collecting removed chains, 0:Free the collected chains and stop */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+
+
+	res = mount_volume(&path, &fs, FA_WRITE);	/* Get logical drive */
+	if (res == FR_OK) {
+		if (opt) {
+			fs->bf_on = 1;
+		} else {
+			fs->bf_on = 0;
+			res = bf_flush(fs);				/* Free the collected blocks */
+			if (res == FR_OK) res = sync_fs(fs);	/* Flush the FAT and FSINFO */
+		}
+	}
+	LEAVE_FF(fs, res);
+}
+
+#endif /* FF_BATCH_FREE && !FF_FS_READONLY */
+
+
+
 #if FF_USE_FORWARD
 /*-----------------------------------------------------------------------*/
 /* Forward Data to the Stream Directly                                   */
@@ -5672,6 +7354,11 @@ FRESULT f_forward (
 	FSIZE_t remain;
 	UINT rcnt, csect;
 	BYTE *dbuf;
+#if FF_FORWARD_SECTORS
+	LBA_t fwsect = 0;
+	FSIZE_t fwofs = 0;
+	UINT cc, fwn = 0;
+#endif
 
 
 	*bf = 0;	/* Clear transfer byte counter */
@@ -5681,6 +7368,7 @@ FRESULT f_forward (
 
 	remain = fp->obj.objsize - fp->fptr;
 	if (btf > remain) btf = (UINT)remain;			/* Truncate btf by remaining bytes */
+	if (btf > 0 && (res = fbuf_bind(fp, 1)) != FR_OK) LEAVE_FF(fs, res);	/* Get the sector buffer */
 
 	for ( ; btf > 0 && (*func)(0, 0); fp->fptr += rcnt, *bf += rcnt, btf -= rcnt) {	/* Repeat until all data transferred or stream goes busy */
 		csect = (UINT)(fp->fptr / SS(fs) & (fs->csize - 1));	/* Sector offset in the cluster */
@@ -5696,6 +7384,36 @@ FRESULT f_forward (
 		sect = clst2sect(fs, fp->clust);			/* Get current data sector */
 		if (sect == 0) ABORT(fs, FR_INT_ERR);
 		sect += csect;
+#if FF_FORWARD_SECTORS
+		if (sect - fwsect >= fwn && fp->fptr % SS(fs) == 0 && btf >= SS(fs)) {	/* Read whole sectors into the span buffer? */
+			cc = btf / SS(fs);						/* Number of whole sectors to forward */
+			if (csect + cc > fs->csize) cc = fs->csize - csect;	/* Clip it at cluster boundary */
+			if (cc > FF_FORWARD_SECTORS) cc = FF_FORWARD_SECTORS;	/* and at the buffer size */
+			dbuf = (BYTE*)fs->fwbuf;
+			if (disk_read(fs->pdrv, dbuf, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
+#if !FF_FS_READONLY
+#if FF_FS_TINY
+			if (fs->wflag && fs->winsect - sect < cc) {	/* Replace one of the read sectors with cached data if it contains a dirty sector */
+				memcpy(dbuf + ((fs->winsect - sect) * SS(fs)), fs->win, SS(fs));
+			}
+#else
+			if ((fp->flag & FA_DIRTY) && fp->sect - sect < cc) {	/* Replace one of the read sectors with cached data if it contains a dirty sector */
+				memcpy(dbuf + ((fp->sect - sect) * SS(fs)), fp->buf, SS(fs));
+			}
+#endif
+#endif
+			fwsect = sect; fwofs = fp->fptr; fwn = cc;
+		}
+		if (sect - fwsect < fwn) {		/* Is the data in the span buffer? */
+			rcnt = (UINT)(sect - fwsect) * SS(fs) + (UINT)fp->fptr % SS(fs);	/* Offset in the span */
+			dbuf = (BYTE*)fs->fwbuf + rcnt;
+			rcnt = fwn * SS(fs) - rcnt;			/* Number of bytes remains in the span */
+			if (rcnt > btf) rcnt = btf;
+			rcnt = (*func)(dbuf, rcnt);		/* Forward the file data */
+			if (rcnt == 0) ABORT(fs, FR_INT_ERR);
+			continue;
+		}
+#endif
 #if FF_FS_TINY
 		if (move_window(fs, sect) != FR_OK) ABORT(fs, FR_DISK_ERR);	/* Move sector window to the file data */
 		dbuf = fs->win;
@@ -5717,6 +7435,23 @@ FRESULT f_forward (
 		rcnt = (*func)(dbuf + ((UINT)fp->fptr % SS(fs)), rcnt);	/* Forward the file data */
 		if (rcnt == 0) ABORT(fs, FR_INT_ERR);
 	}
+#if FF_FORWARD_SECTORS
+	if (fp->fptr % SS(fs) != 0 && fp->fptr - fwofs < (FSIZE_t)fwn * SS(fs)) {	/* Stopped in the middle of a sector of the span? */
+		sect = fwsect + (LBA_t)((fp->fptr - fwofs) / SS(fs));
+#if !FF_FS_TINY
+		if (fp->sect != sect) {		/* Make it the sector in the sector cache, as f_read() and f_write() expect */
+#if !FF_FS_READONLY
+			if (fp->flag & FA_DIRTY) {		/* Write-back dirty sector cache */
+				if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) ABORT(fs, FR_DISK_ERR);
+				fp->flag &= (BYTE)~FA_DIRTY;
+			}
+#endif
+			memcpy(fp->buf, (BYTE*)fs->fwbuf + (UINT)(sect - fwsect) * SS(fs), SS(fs));
+		}
+#endif
+		fp->sect = sect;
+	}
+#endif
 
 	LEAVE_FF(fs, FR_OK);
 }
@@ -6419,6 +8154,99 @@ FRESULT f_fdisk (
 #if FF_USE_LFN && FF_LFN_UNICODE && (FF_STRF_ENCODE < 0 || FF_STRF_ENCODE > 3)
 #error Wrong FF_STRF_ENCODE setting
 #endif
+
+/* f_gets() takes the characters that need no code conversion straight from the
+/  file's sector buffer when the file pointer is in the middle of a sector. */
+#define GETS_IN_PLACE	(!FF_FS_TINY && !(FF_FS_REENTRANT && FF_FILE_BUFFERS) && (!FF_USE_LFN || !FF_LFN_UNICODE || (FF_LFN_UNICODE == 2 && FF_STRF_ENCODE == 3)))
+
+#if GETS_IN_PLACE
+/* Bytes that end a run of characters copied as-is: LF, CR to be stripped and,
+/  with code conversion, the lead and trailing bytes of UTF-8 sequences */
+#define GETS_STOP(c)	((c) == '\n' || (FF_USE_STRFUNC == 2 && (c) == '\r') || (FF_USE_LFN && FF_LFN_UNICODE && (c) >= 0x80))
+
+/*-----------------------------------------------------------------------*/
+/* Get a String from the File - Find the end of a run of plain characters */
+/*-----------------------------------------------------------------------*/
+
+static const BYTE* gets_scan (	/* Returns the first stop byte in [s, e) or e */
+	const BYTE* s,
+	const BYTE* e
+)
+{
+	DWORD w, t, hit;
+
+
+	while (s < e && ((size_t)s & 3)) {	/* Bytes up to a word boundary */
+		if (GETS_STOP(*s)) return s;
+		s++;
+	}
+	for ( ; e - s >= 4; s += 4) {	/* A word at a time: the high bit of a byte of hit is set where a byte of w may stop the run */
+		memcpy(&w, s, 4);
+		t = w ^ 0x0A0A0A0A;
+		hit = (t - 0x01010101) & ~t;	/* Zero bytes of t are LFs */
+		if (FF_USE_STRFUNC == 2) {
+			t = w ^ 0x0D0D0D0D;
+			hit |= (t - 0x01010101) & ~t;
+		}
+		if (FF_USE_LFN && FF_LFN_UNICODE) hit |= w;
+		if (hit & 0x80808080) break;
+	}
+	while (s < e && !GETS_STOP(*s)) s++;
+	return s;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/* Get a String from the File - Copy plain characters in place            */
+/*-----------------------------------------------------------------------*/
+
+static int gets_run (	/* Returns the number of characters stored */
+	FIL* fp,		/* Pointer to the file object */
+	TCHAR* buff,	/* Where to store the characters */
+	int len,		/* Room in buff[] (items) */
+	int* eol		/* Set to 1 when the LF has been stored */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	const BYTE *s, *e, *q;
+	UINT ofs, n;
+	int nc = 0;
+
+
+	*eol = 0;
+	if (!fs || !fs->fs_type || fp->obj.id != fs->id || fp->err != 0 || !(fp->flag & FA_READ)
+#if FF_FILE_BUFFERS
+		|| !fp->buf
+#endif
+		) return 0;
+	ofs = (UINT)fp->fptr % SS(fs);	/* When the file pointer is in the middle of a sector, the sector is in the sector buffer */
+	if (ofs == 0) return 0;
+	n = SS(fs) - ofs;
+	if (n > fp->obj.objsize - fp->fptr) n = (UINT)(fp->obj.objsize - fp->fptr);
+	if (n > (UINT)len) n = (UINT)len;
+	s = fp->buf + ofs; e = s + n;
+	while (s < e) {
+		q = gets_scan(s, e);
+		memcpy(buff + nc, s, (size_t)(q - s));
+		nc += (int)(q - s);
+		s = q;
+		if (s == e) break;
+		if (*s == '\n') {	/* End of line? */
+			buff[nc++] = '\n'; s++;
+			*eol = 1;
+			break;
+		}
+		if (FF_USE_STRFUNC == 2 && *s == '\r') {	/* Strip \r off */
+			s++;
+			continue;
+		}
+		break;		/* A UTF-8 sequence to be converted */
+	}
+	fp->fptr += (FSIZE_t)(s - (fp->buf + ofs));
+	return nc;
+}
+#endif
+
 /*-----------------------------------------------------------------------*/
 /* Get a String from the File                                            */
 /*-----------------------------------------------------------------------*/
@@ -6440,6 +8268,9 @@ TCHAR* f_gets (
 #if FF_USE_LFN && FF_LFN_UNICODE && FF_STRF_ENCODE == 3
 	UINT ct;
 #endif
+#if GETS_IN_PLACE
+	int eol;
+#endif
 
 #if FF_USE_LFN && FF_LFN_UNICODE			/* With code conversion (Unicode API) */
 	/* Make a room for the character and terminator  */
@@ -6447,6 +8278,11 @@ TCHAR* f_gets (
 	if (FF_LFN_UNICODE == 2) len -= (FF_STRF_ENCODE == 0) ? 3 : 4;
 	if (FF_LFN_UNICODE == 3) len -= 1;
 	while (nc < len) {
+#if GETS_IN_PLACE
+		rc = (UINT)gets_run(fp, p, len - nc, &eol);	/* Plain characters in the sector buffer */
+		p += rc; nc += (int)rc;
+		if (eol || nc >= len) break;
+#endif
 #if FF_STRF_ENCODE == 0				/* Read a character in ANSI/OEM */
 		f_read(fp, s, 1, &rc);		/* Get a code unit */
 		if (rc != 1) break;			/* EOF? */
@@ -6533,6 +8369,11 @@ TCHAR* f_gets (
 #else			/* Byte-by-byte read without any conversion (ANSI/OEM API) */
 	len -= 1;	/* Make a room for the terminator */
 	while (nc < len) {
+#if GETS_IN_PLACE
+		rc = (UINT)gets_run(fp, p, len - nc, &eol);	/* Characters in the sector buffer */
+		p += rc; nc += (int)rc;
+		if (eol || nc >= len) break;
+#endif
 		f_read(fp, s, 1, &rc);	/* Get a byte */
 		if (rc != 1) break;		/* EOF? */
 		dc = s[0];
@@ -6551,6 +8392,7 @@ TCHAR* f_gets (
 
 #if !FF_FS_READONLY
 #include <stdarg.h>
+#include "fmt_number.h"		/* Number to text conversion core */
 #define SZ_PUTC_BUF	64
 #define SZ_NUM_BUF	32
 
@@ -6569,15 +8411,67 @@ typedef struct {
 	BYTE bs[4];
 	UINT wi, ct;
 #endif
-	BYTE buf[SZ_PUTC_BUF];	/* Write buffer */
+	int len;		/* Size of buf[] */
+	BYTE *buf;		/* Write buffer: sbuf[] or the free part of the current sector in the file's sector buffer */
+	BYTE sbuf[SZ_PUTC_BUF];	/* Staging buffer */
 } putbuff;
 
 
+/* Select the write buffer for the following characters. In the tiny
+/  configuration, and when the shared file buffers can be taken over by
+/  another task (FF_FILE_BUFFERS with FF_FS_REENTRANT), the characters are
+/  always staged in sbuf[] and written with f_write(). */
+
+static void putc_target (putbuff* pb)
+{
+#if !FF_FS_TINY && !(FF_FS_REENTRANT && FF_FILE_BUFFERS)
+	FIL *fp = pb->fp;
+	FATFS *fs = fp->obj.fs;
+	UINT ofs;
+#endif
+
+	pb->buf = pb->sbuf;		/* Stage the characters and write them with f_write() by default */
+	pb->len = SZ_PUTC_BUF;
+#if !FF_FS_TINY && !(FF_FS_REENTRANT && FF_FILE_BUFFERS)
+	if (fs && fs->fs_type && fp->obj.id == fs->id && fp->err == 0 && (fp->flag & FA_WRITE)
+#if FF_FILE_BUFFERS
+		&& fp->buf
+#endif
+		) {
+		ofs = (UINT)fp->fptr % SS(fs);	/* When the file pointer is in the middle of a sector, the sector is in the sector buffer */
+		if (ofs != 0 && SS(fs) - ofs > 8 && (fs->fs_type == FS_EXFAT || (DWORD)(fp->fptr - ofs) < 0 - (DWORD)SS(fs))) {	/* Room in the sector (and not the last sector below 4 GiB on FAT)? */
+			pb->buf = fp->buf + ofs;	/* Put the characters in place */
+			pb->len = (int)(SS(fs) - ofs);
+		}
+	}
+#endif
+}
+
+
+/* Write the characters in the write buffer to the file */
+
+static int putc_commit (putbuff* pb, int i)	/* 0:succeeded, -1:error */
+{
+	FIL *fp = pb->fp;
+	UINT n;
+
+
+	if (pb->buf == pb->sbuf) {	/* Staged characters? */
+		if (f_write(fp, pb->sbuf, (UINT)i, &n) != FR_OK || n != (UINT)i) return -1;
+	} else if (i > 0) {			/* Characters put in the sector buffer in place */
+		fp->fptr += (UINT)i;
+		if (fp->fptr > fp->obj.objsize) fp->obj.objsize = fp->fptr;
+		fp->flag |= FA_MODIFIED | FA_DIRTY;
+	}
+	putc_target(pb);
+	return 0;
+}
+
+
 /* Buffered file write with code conversion */
 
 static void putc_bfd (putbuff* pb, TCHAR c)
 {
-	UINT n;
 	int i, nc;
 #if FF_USE_LFN && FF_LFN_UNICODE
 	WCHAR hs, wc;
@@ -6695,9 +8589,8 @@ static void putc_bfd (putbuff* pb, TCHAR c)
 	pb->buf[i++] = (BYTE)c;
 #endif
 
-	if (i >= (int)(sizeof pb->buf) - 4) {	/* Write buffered characters to the file */
-		f_write(pb->fp, pb->buf, (UINT)i, &n);
-		i = (n == (UINT)i) ? 0 : -1;
+	if (i >= pb->len - 4) {	/* Write buffered characters to the file */
+		i = putc_commit(pb, i);
 	}
 	pb->idx = i;
 	pb->nchr = nc + 1;
@@ -6708,11 +8601,8 @@ static void putc_bfd (putbuff* pb, TCHAR c)
 
 static int putc_flush (putbuff* pb)
 {
-	UINT nw;
-
 	if (   pb->idx >= 0	/* Flush buffered characters to the file */
-		&& f_write(pb->fp, pb->buf, (UINT)pb->idx, &nw) == FR_OK
-		&& (UINT)pb->idx == nw) return pb->nchr;
+		&& putc_commit(pb, pb->idx) == 0) return pb->nchr;
 	return -1;
 }
 
@@ -6723,6 +8613,7 @@ static void putc_init (putbuff* pb, FIL* fp)
 {
 	memset(pb, 0, sizeof (putbuff));
 	pb->fp = fp;
+	putc_target(pb);
 }
 
 
@@ -6890,13 +8781,12 @@ static void ftoa (
 
 
 
-int f_printf (
+int f_vprintf (
 	FIL* fp,			/* Pointer to the file object */
 	const TCHAR* fmt,	/* Pointer to the format string */
-	...					/* Optional arguments... */
+	va_list arp			/* Arguments */
 )
 {
-	va_list arp;
 	putbuff pb;
 	UINT i, j, w, f, r;
 	int prec;
@@ -6908,13 +8798,14 @@ int f_printf (
 	TCHAR *tp;
 	TCHAR tc, pad;
 	TCHAR nul = 0;
-	char d, str[SZ_NUM_BUF];
+	char d, *np, str[SZ_NUM_BUF];
+#if FF_PRINT_FLOAT && FF_INTDEF == 2
+	double dv;
+#endif
 
 
 	putc_init(&pb, fp);
 
-	va_start(arp, fmt);
-
 	for (;;) {
 		tc = *fmt++;
 		if (tc == 0) break;			/* End of format string */
@@ -6992,7 +8883,14 @@ int f_printf (
 		case 'f':					/* Floating point (decimal) */
 		case 'e':					/* Floating point (e) */
 		case 'E':					/* Floating point (E) */
-			ftoa(str, va_arg(arp, double), prec, tc);	/* Make a floating point string */
+			dv = va_arg(arp, double);
+			np = (tc == 'f') ? fmt_fixed(str, str + SZ_NUM_BUF - 1, dv, prec < 0 ? 6 : prec) : 0;	/* Fast path of decimal notation */
+			if (np) {
+				*np = 0;
+				if (FF_PRINT_FLOAT == 2 && (np = strchr(str, '.')) != 0) *np = ',';	/* Decimal separator */
+			} else {
+				ftoa(str, dv, prec, tc);	/* Make a floating point string */
+			}
 			for (j = strlen(str); !(f & 2) && j < w; j++) putc_bfd(&pb, pad);	/* Left pads */
 			for (i = 0; str[i]; putc_bfd(&pb, str[i++])) ;	/* Body */
 			while (j++ < w) putc_bfd(&pb, ' ');	/* Right pads */
@@ -7024,30 +8922,57 @@ int f_printf (
 			v = 0 - v; f |= 1;
 		}
 #endif
-		i = 0;
-		do {	/* Make an integer number string */
-			d = (char)(v % r); v /= r;
-			if (d > 9) d += (tc == 'x') ? 0x27 : 0x07;
-			str[i++] = d + '0';
-		} while (v && i < SZ_NUM_BUF);
-		if (f & 1) str[i++] = '-';	/* Sign */
+		np = str + SZ_NUM_BUF;	/* Make an integer number string at the end of str[] */
+		if (r == 10) {		/* Decimal number (two digits at a time) */
+#if FF_PRINT_LLI && FF_INTDEF == 2
+			i = fmt_len_u64(v);
+			fmt_u64(np - i, np, v);
+#else
+			i = fmt_len_u32(v);
+			fmt_u32(np - i, np, v);
+#endif
+		} else {
+			i = 0;
+			do {
+				d = (char)(v % r); v /= r;
+				if (d > 9) d += (tc == 'x') ? 0x27 : 0x07;
+				np[-(int)++i] = d + '0';
+			} while (v && i < SZ_NUM_BUF - 1);
+		}
+		if (f & 1) np[-(int)++i] = '-';	/* Sign */
 		/* Write it */
 		for (j = i; !(f & 2) && j < w; j++) {	/* Left pads */
 			putc_bfd(&pb, pad);
 		}
+		np -= i;
 		do {				/* Body */
-			putc_bfd(&pb, (TCHAR)str[--i]);
-		} while (i);
+			putc_bfd(&pb, (TCHAR)*np++);
+		} while (--i);
 		while (j++ < w) {	/* Right pads */
 			putc_bfd(&pb, ' ');
 		}
 	}
 
-	va_end(arp);
-
 	return putc_flush(&pb);
 }
 
+
+int f_printf (
+	FIL* fp,			/* Pointer to the file object */
+	const TCHAR* fmt,	/* Pointer to the format string */
+	...					/* Optional arguments... */
+)
+{
+	va_list arp;
+	int n;
+
+
+	va_start(arp, fmt);
+	n = f_vprintf(fp, fmt, arp);
+	va_end(arp);
+	return n;
+}
+
 #endif /* !FF_FS_READONLY */
 #endif /* FF_USE_STRFUNC */
 
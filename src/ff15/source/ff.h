@@ -27,6 +27,7 @@ extern "C" {
 #endif
 
 #include "ffconf.h"		/* FatFs configuration options */
+#include <stdarg.h>
 
 #if FF_DEFINED != FFCONF_DEF
 #error Wrong configuration file (ffconf.h).
@@ -127,6 +128,38 @@ extern const char* VolumeStr[FF_VOLUMES];	/* User defied volume ID */
 
 
 
+#if FF_DIR_INDEX_SIZE
+/* Directory index record */
+
+typedef struct {
+	DWORD	ofs;			/* Offset of the entry block in the directory */
+	WORD	lhash;			/* Hash of the long name (exFAT: name hash of the entry set) */
+	WORD	shash;			/* Hash of the short name */
+} DIXREC;
+#endif
+
+
+
+#if FF_PATH_CACHE
+/* Path cache entry */
+
+typedef struct {
+	DWORD	base;			/* Start cluster of the directory the path starts from (0:root) */
+	DWORD	sclust;			/* Start cluster of the directory the path leads to */
+#if FF_FS_EXFAT
+	FSIZE_t	objsize;		/* Size of the directory */
+	DWORD	c_scl;			/* Containing directory start cluster */
+	DWORD	c_size;			/* b31-b8:Size of containing directory, b7-b0: Chain status */
+	DWORD	c_ofs;			/* Offset in the containing directory */
+	BYTE	stat;			/* Chain status of the directory */
+#endif
+	BYTE	len;			/* Length of the path (0:unused entry) */
+	TCHAR	path[FF_PATH_CACHE_LEN];	/* Directory part of the path, as given */
+} PCENT;
+#endif
+
+
+
 /* Filesystem object structure (FATFS) */
 
 typedef struct {
@@ -151,6 +184,28 @@ typedef struct {
 #if !FF_FS_READONLY
 	DWORD	last_clst;		/* Last allocated cluster */
 	DWORD	free_clst;		/* Number of free clusters */
+	DWORD	gf_clst;		/* Incremental free cluster scan: next cluster to scan (0:not in progress) */
+	DWORD	gf_nfree;		/* Incremental free cluster scan: free clusters found so far */
+#if FF_FREE_MAP_BYTES
+	BYTE	fmshift;		/* Free cluster map: log2 of the number of clusters per bit */
+	BYTE	fmap[FF_FREE_MAP_BYTES];	/* Free cluster map (0:no free cluster in the group) */
+#endif
+#if FF_PREALLOC_CLUSTERS
+	DWORD	pa_au;			/* Allocation unit of the media [sectors] (0:not known yet) */
+	DWORD	pa_fail;		/* Smallest reservation found not to fit (0:none since clusters were last freed) */
+#endif
+#if FF_BATCH_FREE
+	BYTE	bf_on;			/* Batched freeing: 1:removed chains are collected */
+	UINT	bf_n;			/* Batched freeing: number of blocks in the list */
+	DWORD	bf_run[FF_BATCH_FREE][2];	/* Batched freeing: blocks to be freed (first cluster, number of clusters) in ascending order */
+#endif
+#if FF_LAZY_SYNC
+	BYTE	lzpend;			/* Lazy sync: 1:records loaded from FSInfo are waiting to be recovered */
+	DWORD	lzsect[FF_LAZY_SYNC];	/* Lazy sync records: directory sector of the file from volume top (0:unused) */
+	DWORD	lzclst[FF_LAZY_SYNC];	/* Lazy sync records: start cluster of the file */
+	WORD	lzofs[FF_LAZY_SYNC];	/* Lazy sync records: offset of the entry in the sector */
+	WORD	lzhash[FF_LAZY_SYNC];	/* Lazy sync records: hash of the short name */
+#endif
 #endif
 #if FF_FS_RPATH
 	DWORD	cdir;			/* Current directory start cluster (0:root) */
@@ -159,6 +214,21 @@ typedef struct {
 	DWORD	cdc_size;		/* b31-b8:Size of containing directory, b7-b0: Chain status */
 	DWORD	cdc_ofs;		/* Offset in the containing directory (invalid when cdir is 0) */
 #endif
+#endif
+#if FF_DIR_INDEX_SIZE
+	BYTE	dixstat;		/* Directory index: 0:not in use, 1:in use */
+	WORD	dixn;			/* Directory index: number of records */
+	DWORD	dixclst;		/* Directory index: start cluster of the indexed directory */
+	DWORD	dixhead;		/* Directory index: entry blocks above this offset are not indexed */
+	DWORD	dixend;			/* Directory index: entry blocks from this offset on are not indexed yet */
+	DIXREC	dix[FF_DIR_INDEX_SIZE];	/* Directory index records */
+#endif
+#if FF_PATH_CACHE
+	PCENT	pcache[FF_PATH_CACHE];	/* Path cache (most recently used first) */
+#endif
+#if FF_USE_FASTSEEK && FF_AUTO_CLMT
+	BYTE	clmtuse[FF_AUTO_CLMT];	/* Automatic CLMT pool: 1:slot in use */
+	DWORD	clmtbuf[FF_AUTO_CLMT][FF_AUTO_CLMT_SIZE];	/* Automatic CLMT pool */
 #endif
 	DWORD	n_fatent;		/* Number of FAT entries (number of clusters + 2) */
 	DWORD	fsize;			/* Number of sectors per FAT */
@@ -168,9 +238,34 @@ typedef struct {
 	LBA_t	database;		/* Data base sector */
 #if FF_FS_EXFAT
 	LBA_t	bitbase;		/* Allocation bitmap base sector */
+#endif
+#if FF_FAT_CACHE_SECTORS
+	LBA_t	fcsect[1 + FF_FS_EXFAT];	/* First sector in each part of fcbuf[] (FAT, exFAT allocation bitmap) */
+	UINT	fcn[1 + FF_FS_EXFAT];		/* Number of valid sectors in each part */
+	UINT	fcdlo[1 + FF_FS_EXFAT];		/* Dirty range of each part in sectors [fcdlo, fcdhi) */
+	UINT	fcdhi[1 + FF_FS_EXFAT];
+#endif
+#if FF_DIR_READAHEAD
+	LBA_t	drasect;		/* First sector in the drabuf[] */
+	UINT	dran;			/* Number of valid sectors in the drabuf[] */
 #endif
 	LBA_t	winsect;		/* Current sector appearing in the win[] */
 	BYTE	win[FF_MAX_SS];	/* Disk access window for Directory, FAT (and file data at tiny cfg) */
+#if FF_FAT_CACHE_SECTORS
+	BYTE	fcbuf[FF_FAT_CACHE_SECTORS * FF_MAX_SS];	/* FAT and allocation bitmap cache (FAT is not in win[]) */
+#endif
+#if FF_DIR_READAHEAD
+	BYTE	drabuf[FF_DIR_READAHEAD * FF_MAX_SS];	/* Directory read-ahead buffer */
+#endif
+#if FF_FILE_BUFFERS
+	DWORD	fbtick;			/* File buffer pool: access counter */
+	DWORD	fbuse[FF_FILE_BUFFERS];	/* File buffer pool: access counter at the last access of each buffer */
+	void*	fbown[FF_FILE_BUFFERS];	/* File buffer pool: file object holding each buffer (0:free) */
+	BYTE	fbuf[FF_FILE_BUFFERS][FF_MAX_SS];	/* File buffer pool: sector buffers lent to the file objects */
+#endif
+#if FF_USE_FORWARD && FF_FORWARD_SECTORS
+	DWORD	fwbuf[FF_FORWARD_SECTORS * FF_MAX_SS / 4];	/* f_forward() multi-sector buffer (DWORD for DMA alignment) */
+#endif
 } FATFS;
 
 
@@ -213,8 +308,25 @@ typedef struct {
 #endif
 #if FF_USE_FASTSEEK
 	DWORD*	cltbl;			/* Pointer to the cluster link map table (nulled on open, set by application) */
+#if FF_AUTO_CLMT
+	BYTE	clmtslot;		/* Automatic CLMT slot (0:none, 0xFF:did not fit) */
+#endif
+#endif
+#if !FF_FS_READONLY && FF_PREALLOC_CLUSTERS
+	DWORD	pa_size;		/* Number of clusters to reserve at a time (0:preallocation disabled) */
+	DWORD	pa_clst;		/* First reserved cluster (valid when pa_ncl != 0) */
+	DWORD	pa_ncl;			/* Number of reserved clusters not taken by the file yet */
 #endif
-#if !FF_FS_TINY
+#if !FF_FS_READONLY && FF_LAZY_SYNC
+	BYTE	lzmode;			/* Lazy sync: 1:f_sync may defer the directory entry update */
+	BYTE	lzslot;			/* Lazy sync: record number in the FATFS from 1 (0:not recorded) */
+	DWORD	lzsclust;		/* Lazy sync: start cluster on the directory entry */
+	FSIZE_t	lzsize;			/* Lazy sync: file size on the directory entry */
+	DWORD	lztime;			/* Lazy sync: time of the last directory entry update [ms] */
+#endif
+#if FF_FILE_BUFFERS
+	BYTE*	buf;			/* File data read/write window borrowed from the FATFS (0:not held) */
+#elif !FF_FS_TINY
 	BYTE	buf[FF_MAX_SS];	/* File private data read/write window */
 #endif
 } FIL;
@@ -323,10 +435,13 @@ FRESULT f_chdir (const TCHAR* path);								/* Change current directory */
 FRESULT f_chdrive (const TCHAR* path);								/* Change current drive */
 FRESULT f_getcwd (TCHAR* buff, UINT len);							/* Get current directory */
 FRESULT f_getfree (const TCHAR* path, DWORD* nclst, FATFS** fatfs);	/* Get number of free clusters on the drive */
+FRESULT f_getfree_step (const TCHAR* path, DWORD* nclst, UINT nsect, BYTE* done);	/* Count free clusters a few FAT sectors at a time */
 FRESULT f_getlabel (const TCHAR* path, TCHAR* label, DWORD* vsn);	/* Get volume label */
 FRESULT f_setlabel (const TCHAR* label);							/* Set volume label */
 FRESULT f_forward (FIL* fp, UINT(*func)(const BYTE*,UINT), UINT btf, UINT* bf);	/* Forward data to the stream */
 FRESULT f_expand (FIL* fp, FSIZE_t fsz, BYTE opt);					/* Allocate a contiguous block to the file */
+FRESULT f_prealloc (FIL* fp, DWORD ncl);							/* Set number of clusters to reserve at a time as the file grows */
+FRESULT f_batchfree (const TCHAR* path, BYTE opt);					/* Start or finish batched freeing of removed chains */
 FRESULT f_mount (FATFS* fs, const TCHAR* path, BYTE opt);			/* Mount/Unmount a logical drive */
 FRESULT f_mkfs (const TCHAR* path, const MKFS_PARM* opt, void* work, UINT len);	/* Create a FAT volume */
 FRESULT f_fdisk (BYTE pdrv, const LBA_t ptbl[], void* work);		/* Divide a physical drive into some partitions */
@@ -334,6 +449,7 @@ FRESULT f_setcp (WORD cp);											/* Set current code page */
 int f_putc (TCHAR c, FIL* fp);										/* Put a character to the file */
 int f_puts (const TCHAR* str, FIL* cp);								/* Put a string to the file */
 int f_printf (FIL* fp, const TCHAR* str, ...);						/* Put a formatted string to the file */
+int f_vprintf (FIL* fp, const TCHAR* str, va_list arp);				/* Put a formatted string to the file (with a va_list) */
 TCHAR* f_gets (TCHAR* buff, int len, FIL* fp);						/* Get a string from the file */
 
 /* Some API fucntions are implemented as macro */
@@ -371,10 +487,23 @@ DWORD ff_wtoupper (DWORD uni);			/* Unicode upper-case conversion */
 
 /* O/S dependent functions (samples available in ffsystem.c) */
 
-#if FF_USE_LFN == 3		/* Dynamic memory allocation */
+#if FF_USE_LFN == 3 || FF_MEMPOOL_BLOCKS	/* Dynamic memory allocation */
 void* ff_memalloc (UINT msize);		/* Allocate memory block */
 void ff_memfree (void* mblock);		/* Free memory block */
 #endif
+#if FF_MEMPOOL_BLOCKS
+typedef struct {
+	UINT	blocks;		/* Number of blocks in the pool */
+	UINT	size;		/* Size of a block [bytes] */
+	UINT	used;		/* Number of blocks in use */
+	UINT	peak;		/* Largest number of blocks in use at a time (high-water mark) */
+	DWORD	heap;		/* Number of requests served from the heap (too large or pool empty) */
+} FF_MEMPOOL_STAT;
+void ff_mempool_stat (FF_MEMPOOL_STAT* stat);	/* Get statistics of the memory block pool */
+#endif
+#if FF_LAZY_SYNC && !FF_FS_READONLY
+DWORD ff_uptime_ms (void);			/* Get a free running millisecond counter */
+#endif
 #if FF_FS_REENTRANT	/* Sync functions */
 int ff_mutex_create (int vol);		/* Create a sync object */
 void ff_mutex_delete (int vol);		/* Delete a sync object */
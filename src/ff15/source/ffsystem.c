@@ -5,7 +5,7 @@
 #include "ff.h"
 
 
-#if FF_USE_LFN == 3	/* Use dynamic memory allocation */
+#if FF_USE_LFN == 3 || FF_MEMPOOL_BLOCKS	/* Use dynamic memory allocation */
 
 /*------------------------------------------------------------------------*/
 /* Allocate/Free a Memory Block                                           */
@@ -13,6 +13,111 @@
 
 #include <stdlib.h>		/* with POSIX API */
 
+#if FF_MEMPOOL_BLOCKS
+/* Requests that fit in a block are served from a static pool of fixed-size
+/  blocks in constant time, so that the LFN working buffers and the file
+/  objects of streams do not fragment the heap. Larger requests, and any
+/  request while the pool is empty, go to the heap. The free list is shared by
+/  both cores and is guarded by a hardware spin lock, which is held only while
+/  a block is linked or unlinked. (The Cortex-M0+ of the RP2040 has no
+/  exclusive access instructions for a lock-free list.) */
+
+#include "hardware/sync.h"
+
+#define LFNBUF_SIZE	((FF_MAX_LFN + 1) * 2 + (FF_FS_EXFAT ? (FF_MAX_LFN + 44) / 15 * 32 : 0))
+#define STREAM_SIZE	(sizeof (FIL) + 2 * sizeof (void*))	/* A FIL and the buffer pointer and size kept with it (cookie_t in file_stream.c) */
+
+typedef union POOLBLK_ {	/* Pool block */
+	union POOLBLK_* next;	/* Next free block */
+	double	align;			/* Alignment for any object */
+#if FF_MEMPOOL_BLOCK_SIZE
+	BYTE	data[FF_MEMPOOL_BLOCK_SIZE];
+#else
+	BYTE	data[LFNBUF_SIZE > STREAM_SIZE ? LFNBUF_SIZE : STREAM_SIZE];	/* LFN working buffer or stream file object */
+#endif
+} POOLBLK;
+
+static POOLBLK Pool[FF_MEMPOOL_BLOCKS];	/* Block pool */
+static POOLBLK* PoolFree;				/* Free list */
+static BYTE PoolReady;					/* The free list has been built */
+static FF_MEMPOOL_STAT PoolStat;		/* Statistics */
+
+
+static spin_lock_t* pool_lock (void)
+{
+	return spin_lock_instance(PICO_SPINLOCK_ID_STRIPED_FIRST);	/* A shared lock for short critical sections */
+}
+
+
+void* ff_memalloc (	/* Returns pointer to the allocated memory block (null if not enough core) */
+	UINT msize		/* Number of bytes to allocate */
+)
+{
+	POOLBLK* blk = 0;
+	UINT i, irq;
+
+
+	if (msize <= sizeof Pool[0].data) {
+		irq = spin_lock_blocking(pool_lock());
+		if (!PoolReady) {	/* Build the free list on the first use */
+			for (i = 0; i < FF_MEMPOOL_BLOCKS - 1; i++) Pool[i].next = &Pool[i + 1];
+			Pool[i].next = 0;
+			PoolFree = Pool;
+			PoolReady = 1;
+		}
+		blk = PoolFree;
+		if (blk) {	/* Take the first free block */
+			PoolFree = blk->next;
+			if (++PoolStat.used > PoolStat.peak) PoolStat.peak = PoolStat.used;
+		}
+		spin_unlock(pool_lock(), irq);
+		if (blk) return blk;
+	}
+	blk = malloc((size_t)msize);	/* Allocate a new memory block */
+	if (blk) {
+		irq = spin_lock_blocking(pool_lock());
+		PoolStat.heap++;
+		spin_unlock(pool_lock(), irq);
+	}
+	return blk;
+}
+
+
+void ff_memfree (
+	void* mblock	/* Pointer to the memory block to free (no effect if null) */
+)
+{
+	POOLBLK* blk = mblock;
+	UINT irq;
+
+
+	if (blk >= Pool && blk < Pool + FF_MEMPOOL_BLOCKS) {	/* Is it a pool block? */
+		irq = spin_lock_blocking(pool_lock());
+		blk->next = PoolFree;	/* Put it back on the free list */
+		PoolFree = blk;
+		PoolStat.used--;
+		spin_unlock(pool_lock(), irq);
+	} else {
+		free(mblock);	/* Free the memory block */
+	}
+}
+
+
+void ff_mempool_stat (
+	FF_MEMPOOL_STAT* stat	/* Pointer to the structure to receive the statistics */
+)
+{
+	UINT irq;
+
+
+	irq = spin_lock_blocking(pool_lock());
+	*stat = PoolStat;
+	spin_unlock(pool_lock(), irq);
+	stat->blocks = FF_MEMPOOL_BLOCKS;
+	stat->size = sizeof Pool[0].data;
+}
+
+#else
 
 void* ff_memalloc (	/* Returns pointer to the allocated memory block (null if not enough core) */
 	UINT msize		/* Number of bytes to allocate */
@@ -30,6 +135,7 @@ void ff_memfree (
 }
 
 #endif
+#endif
 
 
 
@@ -39,7 +145,9 @@ void ff_memfree (
 /* Definitions of Mutex                                                   */
 /*------------------------------------------------------------------------*/
 
-#define OS_TYPE	0	/* 0:Win32, 1:uITRON4.0, 2:uC/OS-II, 3:FreeRTOS, 4:CMSIS-RTOS */
+#ifndef OS_TYPE
+#define OS_TYPE	5	/* 0:Win32, 1:uITRON4.0, 2:uC/OS-II, 3:FreeRTOS, 4:CMSIS-RTOS, 5:Pico SDK */
+#endif
 
 
 #if   OS_TYPE == 0	/* Win32 */
@@ -64,6 +172,10 @@ static SemaphoreHandle_t Mutex[FF_VOLUMES + 1];	/* Table of mutex handle */
 #include "cmsis_os.h"
 static osMutexId Mutex[FF_VOLUMES + 1];	/* Table of mutex ID */
 
+#elif OS_TYPE == 5	/* Raspberry Pi Pico SDK (no OS; works across both cores) */
+#include "pico/mutex.h"
+static mutex_t Mutex[FF_VOLUMES + 1];	/* Table of mutexes. FF_FS_TIMEOUT is in ms. */
+
 #endif
 
 
@@ -106,6 +218,10 @@ int ff_mutex_create (	/* Returns 1:Function succeeded or 0:Could not create the
 	Mutex[vol] = osMutexCreate(osMutex(cmsis_os_mutex));
 	return (int)(Mutex[vol] != NULL);
 
+#elif OS_TYPE == 5	/* Pico SDK */
+	if (!mutex_is_initialized(&Mutex[vol])) mutex_init(&Mutex[vol]);
+	return 1;
+
 #endif
 }
 
@@ -138,6 +254,9 @@ void ff_mutex_delete (	/* Returns 1:Function succeeded or 0:Could not delete due
 #elif OS_TYPE == 4	/* CMSIS-RTOS */
 	osMutexDelete(Mutex[vol]);
 
+#elif OS_TYPE == 5	/* Pico SDK */
+	(void)vol;	/* Nothing to release; the mutex is reused on the next f_mount */
+
 #endif
 }
 
@@ -171,6 +290,9 @@ int ff_mutex_take (	/* Returns 1:Succeeded or 0:Timeout */
 #elif OS_TYPE == 4	/* CMSIS-RTOS */
 	return (int)(osMutexWait(Mutex[vol], FF_FS_TIMEOUT) == osOK);
 
+#elif OS_TYPE == 5	/* Pico SDK */
+	return (int)mutex_enter_timeout_ms(&Mutex[vol], FF_FS_TIMEOUT);
+
 #endif
 }
 
@@ -201,8 +323,28 @@ void ff_mutex_give (
 #elif OS_TYPE == 4	/* CMSIS-RTOS */
 	osMutexRelease(Mutex[vol]);
 
+#elif OS_TYPE == 5	/* Pico SDK */
+	mutex_exit(&Mutex[vol]);
+
 #endif
 }
 
 #endif	/* FF_FS_REENTRANT */
 
+
+
+
+#if FF_LAZY_SYNC && !FF_FS_READONLY
+/*------------------------------------------------------------------------*/
+/* Get a Millisecond Counter for Lazy Sync                                */
+/*------------------------------------------------------------------------*/
+/* Any free running counter will do; only differences are used. */
+
+#include "pico/time.h"
+
+DWORD ff_uptime_ms (void)
+{
+	return to_ms_since_boot(get_absolute_time());
+}
+
+#endif
@@ -30,6 +30,10 @@
 #define MERGE2(a, b) a ## b
 #define CVTBL(tbl, cp) MERGE2(tbl, cp)
 
+#if FF_FAST_UNICODE
+#include "ffuctbl.h"	/* Two-level lookup tables generated by mkuctbl.py */
+#endif
+
 
 /*------------------------------------------------------------------------*/
 /* Code Conversion Tables                                                 */
@@ -15225,7 +15229,11 @@ WCHAR ff_uni2oem (	/* Returns OEM code character, zero on error */
 )
 {
 	WCHAR c = 0;
+#if FF_FAST_UNICODE >= 2
+	UINT i;
+#else
 	const WCHAR* p = CVTBL(uc, FF_CODE_PAGE);
+#endif
 
 
 	if (uni < 0x80) {	/* ASCII? */
@@ -15233,8 +15241,15 @@ WCHAR ff_uni2oem (	/* Returns OEM code character, zero on error */
 
 	} else {			/* Non-ASCII */
 		if (uni < 0x10000 && cp == FF_CODE_PAGE) {	/* Is it in BMP and valid code page? */
+#if FF_FAST_UNICODE >= 2
+			i = (UINT)(uni >> OCT_SHIFT);
+			if (i < sizeof oct_idx && (i = oct_idx[i]) != 0) {	/* Look up the block and the code in it */
+				c = oct_blk[i - 1][uni & ((1 << OCT_SHIFT) - 1)];
+			}
+#else
 			for (c = 0; c < 0x80 && uni != p[c]; c++) ;
 			c = (c + 0x80) & 0xFF;
+#endif
 		}
 	}
 
@@ -15465,6 +15480,19 @@ DWORD ff_wtoupper (	/* Returns up-converted code point */
 	DWORD uni		/* Unicode code point to be up-converted */
 )
 {
+#if FF_FAST_UNICODE
+	UINT i;
+
+
+	if (uni < 0x80) {	/* ASCII? */
+		return (uni >= 'a' && uni <= 'z') ? uni - 0x20 : uni;
+	}
+	if (uni < 0x10000 && (i = uct_idx[uni >> UCT_SHIFT]) != 0) {	/* Is it in BMP and in a block with any case conversion? */
+		uni = (WORD)(uni + uct_blk[i - 1][uni & ((1 << UCT_SHIFT) - 1)]);
+	}
+
+	return uni;
+#else
 	const WORD* p;
 	WORD uc, bc, nc, cmd;
 	static const WORD cvt1[] = {	/* Compressed up conversion table for U+0000 - U+0FFF */
@@ -15560,6 +15588,9 @@ DWORD ff_wtoupper (	/* Returns up-converted code point */
 	};
 
 
+	if (uni < 0x80) {	/* ASCII? */
+		return (uni >= 'a' && uni <= 'z') ? uni - 0x20 : uni;
+	}
 	if (uni < 0x10000) {	/* Is it in BMP? */
 		uc = (WORD)uni;
 		p = uc < 0x1000 ? cvt1 : cvt2;
@@ -15587,6 +15618,7 @@ DWORD ff_wtoupper (	/* Returns up-converted code point */
 	}
 
 	return uni;
+#endif
 }
 
 
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""Generate ffuctbl.h, the two-level lookup tables used by ffunicode.c when
+FF_FAST_UNICODE is enabled, from the compressed tables in ffunicode.c.
+
+Usage: python3 mkuctbl.py [ffunicode.c] [ffuctbl.h]
+
+Run it again whenever the tables in ffunicode.c change.
+"""
+import os
+import re
+import sys
+
+UCT_SHIFT = 5  # Up-case table: code points per block = 1 << UCT_SHIFT
+OCT_SHIFT = 7  # Unicode to OEM table: code points per block = 1 << OCT_SHIFT
+
+here = os.path.dirname(os.path.abspath(__file__))
+src_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, 'ffunicode.c')
+out_path = sys.argv[2] if len(sys.argv) > 2 else os.path.join(here, 'ffuctbl.h')
+
+with open(src_path, newline='') as f:
+    src = f.read().replace('\r\n', '\n')
+
+
+def numbers(text):
+    return [int(x, 16) for x in re.findall(r'0x[0-9A-Fa-f]+', re.sub(r'/\*.*?\*/', '', text, flags=re.S))]
+
+
+def wtoupper_table(name):
+    m = re.search(r'static const WORD ' + name + r'\[\] = \{[^\n]*\n(.*?)\n\t\};', src, re.S)
+    return numbers(m.group(1))
+
+
+cvt1 = wtoupper_table('cvt1')
+cvt2 = wtoupper_table('cvt2')
+SHIFTS = {2: -16, 3: -32, 4: -48, 5: -26, 6: 8, 7: -80, 8: -0x1C60}
+
+
+def wtoupper(uc):
+    """Same as ff_wtoupper() for a BMP code point"""
+    p = cvt1 if uc < 0x1000 else cvt2
+    k = 0
+    while True:
+        bc = p[k]
+        k += 1
+        if bc == 0 or uc < bc:
+            return uc
+        nc = p[k]
+        k += 1
+        cmd = nc >> 8
+        nc &= 0xFF
+        if uc < bc + nc:
+            if cmd == 0:
+                return p[k + uc - bc]
+            if cmd == 1:
+                return uc - ((uc - bc) & 1)
+            return (uc + SHIFTS[cmd]) & 0xFFFF
+        if cmd == 0:
+            k += nc
+
+
+def two_level(values, shift, empty):
+    """Split values into blocks, share identical blocks and drop empty ones"""
+    size = 1 << shift
+    index, blocks = [], []
+    for b in range(len(values) >> shift):
+        blk = tuple(values[b << shift:(b + 1) << shift])
+        if all(v == empty for v in blk):
+            index.append(0)
+            continue
+        if blk not in blocks:
+            blocks.append(blk)
+        index.append(blocks.index(blk) + 1)
+    assert len(blocks) < 256
+    return index, blocks
+
+
+def rows(values, fmt, per_line, indent='\t'):
+    out = []
+    for i in range(0, len(values), per_line):
+        out.append(indent + ','.join(fmt % v for v in values[i:i + per_line]) + ',')
+    out[-1] = out[-1][:-1]
+    return out
+
+
+lines = [
+    '/*------------------------------------------------------------------------*/',
+    '/* Two-level lookup tables for ffunicode.c (FF_FAST_UNICODE)               */',
+    '/*------------------------------------------------------------------------*/',
+    '/* Generated from the tables in ffunicode.c by mkuctbl.py. Do not edit.',
+    '/  Each table is a block index by the upper bits of the code point (0: no',
+    '/  entry in the block) followed by the blocks, identical blocks shared.',
+    '/  The index of a Unicode to OEM table ends at the last block in use. */',
+    '',
+    '#define UCT_SHIFT\t%d\t/* Up-case table: code points per block = 1 << UCT_SHIFT */' % UCT_SHIFT,
+    '#define OCT_SHIFT\t%d\t/* Unicode to OEM table: code points per block = 1 << OCT_SHIFT */' % OCT_SHIFT,
+    '',
+]
+
+delta = [(wtoupper(u) - u) & 0xFFFF for u in range(0x10000)]
+index, blocks = two_level(delta, UCT_SHIFT, 0)
+lines += ['static const BYTE uct_idx[] = {\t/* Up-case conversion: block index */']
+lines += rows(index, '%3d', 32)
+lines += ['};', 'static const WORD uct_blk[][1 << UCT_SHIFT] = {\t/* Up-case conversion: difference to be added */']
+for i, blk in enumerate(blocks):
+    lines += ['\t{'] + rows(blk, '0x%04X', 16, '\t\t') + ['\t}' + (',' if i + 1 < len(blocks) else '')]
+lines += ['};', '']
+
+for cp in [int(x) for x in re.findall(r'static const WCHAR uc(\d+)\[\]', src)]:
+    m = re.search(r'static const WCHAR uc%d\[\] = \{[^\n]*\n(.*?)\};' % cp, src, re.S)
+    oem = [0] * 0x10000
+    for i, u in enumerate(numbers(m.group(1))):
+        if u and not oem[u]:
+            oem[u] = 0x80 + i
+    index, blocks = two_level(oem, OCT_SHIFT, 0)
+    while not index[-1]:  # Blocks past the last one used need no index
+        index.pop()
+    lines += ['#if FF_FAST_UNICODE >= 2 && FF_CODE_PAGE == %d' % cp]
+    lines += ['static const BYTE oct_idx[] = {\t/* Unicode to CP%d: block index */' % cp]
+    lines += rows(index, '%2d', 32)
+    lines += ['};', 'static const BYTE oct_blk[][1 << OCT_SHIFT] = {\t/* Unicode to CP%d: OEM code (0:none) */' % cp]
+    for i, blk in enumerate(blocks):
+        lines += ['\t{'] + rows(blk, '0x%02X', 16, '\t\t') + ['\t}' + (',' if i + 1 < len(blocks) else '')]
+    lines += ['};', '#endif']
+lines += ['']
+
+with open(out_path, 'w', newline='') as f:
+    f.write('\r\n'.join(lines))
@@ -21,10 +21,34 @@ specific language governing permissions and limitations under the License.
 //
 #include "my_debug.h"
 
+/* Size in bytes of a read/write buffer in each FF_FILE for the byte and line
+ * oriented calls (ff_fputc, ff_fgetc and ff_fgets) and for ff_fwrite and
+ * ff_fread calls smaller than the buffer. Transfers between the
+ * buffer and the file stay within buffer-sized blocks of the file, so a
+ * multiple of the sector size (512) keeps them in whole sectors.
+ * 0 makes FF_FILE a plain FatFs FIL, with every call going to f_read or
+ * f_write.
+ * It can also be set with a compile definition. */
+#ifndef FF_STDIO_BUF_SIZE
+#define FF_STDIO_BUF_SIZE 0
+#endif
+
 #define BaseType_t int
+#if FF_STDIO_BUF_SIZE
+typedef struct {
+    FIL fil;
+    BYTE wr;   /* 1: buf holds bytes to write; 0: bytes read ahead */
+    UINT pos;  /* Next byte in buf: read ahead up to len; to write before it */
+    UINT len;  /* End of the read ahead bytes, or of the room to write */
+    BYTE buf[FF_STDIO_BUF_SIZE] __attribute__((aligned(4)));
+} FF_FILE;
+#else
 #define FF_FILE FIL
-
 #define ff_rewind f_rewind
+#define ff_filelength f_size
+#define ff_feof f_eof
+#endif
+
 #define pvPortMalloc malloc
 #define vPortFree free
 #define ffconfigMAX_FILENAME 250
@@ -37,8 +61,6 @@ specific language governing permissions and limitations under the License.
 #define FF_SEEK_END 2
 #define pdFALSE 0
 #define pdTRUE 1
-#define ff_filelength f_size
-#define ff_feof f_eof
 
 typedef struct FF_STAT {
     uint32_t st_size; /* Size of the object in number of bytes. */
@@ -75,3 +97,8 @@ FF_FILE *ff_truncate( const char * pcFileName, long lTruncateSize );
 int ff_seteof( FF_FILE *pxStream );
 int ff_rename( const char *pcOldName, const char *pcNewName, int bDeleteIfExists );
 char *ff_fgets(char *pcBuffer, size_t xCount, FF_FILE *pxStream);
+#if FF_STDIO_BUF_SIZE
+int ff_rewind(FF_FILE *pxStream);
+FSIZE_t ff_filelength(FF_FILE *pxStream);
+int ff_feof(FF_FILE *pxStream);
+#endif
@@ -37,10 +37,63 @@
 #define FF_USE_FASTSEEK	1
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
+#ifndef FF_AUTO_CLMT
+#define FF_AUTO_CLMT		0
+#endif
+#ifndef FF_AUTO_CLMT_SIZE
+#define FF_AUTO_CLMT_SIZE	64
+#endif
+/* FF_AUTO_CLMT sets the number of cluster link map tables (CLMTs) that each
+/  filesystem object keeps in a pool for fast seek mode, FF_AUTO_CLMT_SIZE the
+/  size of each table in items (a file of n fragments needs 2n + 2 items).
+/  On the second f_lseek of a file of more than one cluster with no CLMT of its
+/  own that moves the file pointer to other than the end of the file, the
+/  library maps the file into a free table, so that later seeks and reads do
+/  not follow the FAT chain. The map grows with the file and goes back to the
+/  pool on f_close. A file whose chain does not fit (or outgrows the table)
+/  falls back to normal seek mode; one that seeks while the pool is exhausted
+/  tries again on its next such seek. Needs FF_USE_FASTSEEK. 0 disables the
+/  pool (at most 253). They can also be set with compile definitions. */
+
 
 #define FF_USE_EXPAND	1
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
+#ifndef FF_PREALLOC_CLUSTERS
+#define FF_PREALLOC_CLUSTERS	0
+#endif
+/* FF_PREALLOC_CLUSTERS enables contiguous preallocation for growing files and
+/  sets the default number of clusters that a file opened for writing reserves
+/  at a time. When f_write or f_lseek needs a new cluster, the file reserves a
+/  contiguous area of this many clusters, starting at an allocation unit
+/  boundary of the media (disk_ioctl GET_ALLOC_UNIT) where possible, and then
+/  takes its clusters from it in order, so files growing at the same time do
+/  not interleave. f_prealloc() changes the size for a file (0 disables it).
+/  The unused part goes back to the volume on f_close and f_truncate; until
+/  then it is counted as used, and left as a lost chain if the power fails.
+/  0 disables the feature and f_prealloc(). It can also be set with a compile
+/  definition. */
+
+#ifndef FF_LAZY_SYNC
+#define FF_LAZY_SYNC		0
+#endif
+#ifndef FF_LAZY_SYNC_BYTES
+#define FF_LAZY_SYNC_BYTES	65536
+#endif
+#ifndef FF_LAZY_SYNC_MS
+#define FF_LAZY_SYNC_MS		1000
+#endif
+/* FF_LAZY_SYNC enables lazy sync mode on FAT32 volumes and sets the number of
+/  files per volume that can be in it at a time. f_sync of a file in lazy sync
+/  writes the file data and the FAT, but leaves the directory entry and the
+/  free cluster count in FSInfo as they are until the file has grown by
+/  FF_LAZY_SYNC_BYTES or FF_LAZY_SYNC_MS milliseconds (0:no time limit) have
+/  passed since they were last updated. The entry is listed in FSInfo while it
+/  is out of date (up to 39 entries), and the first write access after the next
+/  mount sets the size of a listed file from its cluster chain. f_close always
+/  updates the entry. ff_uptime_ms() provides the time base. They can also be
+/  set with compile definitions. */
+
 
 #define FF_USE_CHMOD	0
 /* This option switches attribute manipulation functions, f_chmod() and f_utime().
@@ -52,10 +105,22 @@
 /  (0:Disable or 1:Enable) */
 
 
-#define FF_USE_FORWARD	0
+#define FF_USE_FORWARD	1
 /* This option switches f_forward() function. (0:Disable or 1:Enable) */
 
 
+#ifndef FF_FORWARD_SECTORS
+#define FF_FORWARD_SECTORS	0
+#endif
+/* When this option is not 0, f_forward() reads the whole sectors of a transfer
+/  that starts on a sector boundary, up to this many at a time within a cluster,
+/  with one multi-sector read into a word-aligned buffer in the filesystem object
+/  (FATFS), and passes the whole span to the streaming function in one call.
+/  Otherwise the file data is forwarded a sector at a time from the sector buffer
+/  of the file object. Each FATFS grows by FF_FORWARD_SECTORS * FF_MAX_SS bytes.
+/  It can also be set with a compile definition. */
+
+
 #define FF_USE_STRFUNC	1
 #define FF_PRINT_LLI	1
 #define FF_PRINT_FLOAT	1
@@ -113,6 +178,23 @@
 */
 
 
+#ifndef FF_FAST_UNICODE
+#define FF_FAST_UNICODE	0
+#endif
+/* This option selects how Unicode characters are up-case converted and converted
+/  to the OEM code, which happens for each character of each long file name
+/  compared in a directory search.
+/
+/   0: Search the compact tables. (ASCII characters are converted directly)
+/   1: Up-case convert with a two-level lookup table in constant time. +4 KiB
+/   2: 1 + convert Unicode to an SBCS code page (FF_CODE_PAGE < 900) with a
+/      two-level lookup table. +1..2 KiB
+/
+/  The tables are in ffuctbl.h, which is generated from ffunicode.c by
+/  mkuctbl.py. DBCS code pages and FF_CODE_PAGE 0 keep the binary search.
+/  It can also be set with a compile definition. */
+
+
 #define FF_USE_LFN		3
 #define FF_MAX_LFN		255
 /* The FF_USE_LFN switches the support for LFN (long file name).
@@ -133,6 +215,27 @@
 /  ff_memfree() exemplified in ffsystem.c, need to be added to the project. */
 
 
+#ifndef FF_MEMPOOL_BLOCKS
+#define FF_MEMPOOL_BLOCKS		0
+#endif
+#ifndef FF_MEMPOOL_BLOCK_SIZE
+#define FF_MEMPOOL_BLOCK_SIZE	0
+#endif
+/* FF_MEMPOOL_BLOCKS sets the number of blocks in a static pool that
+/  ff_memalloc() in ffsystem.c serves requests from before it falls back to the
+/  heap. With FF_USE_LFN == 3, each API call working on names takes one block
+/  for the LFN working buffer, and each stream opened with open_file_stream()
+/  takes one for its file object, so the pool needs one block per concurrent
+/  call (per volume with FF_FS_REENTRANT) plus one per open stream.
+/  FF_MEMPOOL_BLOCK_SIZE is the size of a block in bytes; 0 sizes it to hold the
+/  LFN working buffer and a stream's file object, and a nonzero size must hold
+/  the file object too. With FF_MEMPOOL_BLOCK_SIZE at least
+/  FILE_STREAM_BUF_SIZE (see file_stream.h), a stream also takes a block for its
+/  stdio buffer. ff_mempool_stat() reports the use of the pool, including the
+/  high-water mark. 0 disables the pool.
+/  They can also be set with compile definitions. */
+
+
 #define FF_LFN_UNICODE	2
 /* This option switches the character encoding on the API when LFN is enabled.
 /
@@ -231,6 +334,108 @@
 /  buffer in the filesystem object (FATFS) is used for the file data transfer. */
 
 
+#ifndef FF_FILE_BUFFERS
+#define FF_FILE_BUFFERS		0
+#endif
+/* This option is a middle way between the normal and the tiny configuration.
+/  When it is not 0, the file object (FIL) holds no private sector buffer, and
+/  each filesystem object (FATFS) gets a pool of this many sector buffers that
+/  are lent to the open files when they are read, written or seeked. When all of
+/  them are in use, the least recently used one is taken over; its dirty data is
+/  written back and its previous owner reloads the sector on its next access.
+/  So the memory for file data follows the number of files under active I/O
+/  rather than the number of open files. Each FIL shrinks by FF_MAX_SS bytes
+/  and each FATFS grows by FF_FILE_BUFFERS * FF_MAX_SS bytes. FF_FS_TINY must be 0.
+/  A file object must be closed with f_close() before it is discarded.
+/  It can also be set with a compile definition. */
+
+
+#ifndef FF_FAT_CACHE_SECTORS
+#define FF_FAT_CACHE_SECTORS	0
+#endif
+/* This option gives each filesystem object (FATFS) a cache of this many sectors
+/  for the FAT and the exFAT allocation bitmap, in place of the common sector
+/  window win[]. The cache is filled with one multi-sector read, and its dirty
+/  sectors are written back (and mirrored to the 2nd FAT) with one multi-sector
+/  write when it moves or when the volume is synchronized. This speeds up FAT
+/  chain walks (f_lseek, f_open for append), cluster allocation and f_getfree,
+/  and stops FAT accesses from evicting directory sectors from win[].
+/  0 disables the cache; otherwise it must be 2 or more. On exFAT volumes, half
+/  of the cache holds the FAT and half the allocation bitmap.
+/  Each FATFS grows by FF_FAT_CACHE_SECTORS * FF_MAX_SS bytes.
+/  It can also be set with a compile definition. */
+
+
+#ifndef FF_FREE_MAP_BYTES
+#define FF_FREE_MAP_BYTES	0
+#endif
+/* This option gives each filesystem object (FATFS) a map of this many bytes
+/  that records which parts of a FAT12/16/32 volume have no free cluster, so
+/  that cluster allocation (create_chain, f_expand) skips them without reading
+/  the FAT. Each bit covers a power-of-2 group of clusters, enough for the map
+/  to span the volume. A bit is cleared when the whole group has been seen to
+/  be in use and set again when a cluster in it is freed. The map is filled in
+/  as allocation goes along, and completely by an f_getfree scan of the FAT.
+/  0 disables the map. Not used on exFAT volumes, whose allocation bitmap
+/  serves the purpose. It can also be set with a compile definition. */
+
+
+#ifndef FF_DIR_INDEX_SIZE
+#define FF_DIR_INDEX_SIZE	0
+#endif
+/* This option gives each filesystem object (FATFS) an in-RAM index of up to
+/  this many entries (8 bytes each) of one large directory, so that finding a
+/  file there (f_open, f_stat, f_unlink...) verifies only the entries whose
+/  name hash matches instead of comparing every entry. The index is built as
+/  the directory is searched, kept up to date as entries are created and
+/  removed, and taken over by another directory once that one is searched past
+/  its first 64 entries. Entries beyond the budget are searched linearly.
+/  0 disables the index. Requires FF_USE_LFN. It can also be set with a compile
+/  definition. */
+
+
+#ifndef FF_PATH_CACHE
+#define FF_PATH_CACHE		0
+#endif
+#ifndef FF_PATH_CACHE_LEN
+#define FF_PATH_CACHE_LEN	64
+#endif
+/* FF_PATH_CACHE sets the number of entries in each filesystem object's cache
+/  of recently followed directory paths. A path such as /data/2026/10/f.csv
+/  then starts at the cached /data/2026/10 directory instead of searching the
+/  root, data, 2026 and 10 directories again. Directory parts longer than
+/  FF_PATH_CACHE_LEN characters (1..255) are not cached. The cache is cleared
+/  when a directory is renamed or removed (and, on exFAT, when a directory
+/  grows) and on mount, which includes after f_mkfs. 0 disables the cache.
+/  They can also be set with compile definitions. */
+
+
+#ifndef FF_DIR_READAHEAD
+#define FF_DIR_READAHEAD	0
+#endif
+/* This option gives each filesystem object (FATFS) a buffer of this many
+/  sectors for reading directories ahead. When a directory search or listing
+/  (f_readdir, f_findnext, f_open...) moves to a sector that is not in the
+/  buffer, the rest of the cluster (up to this many sectors) is read in one
+/  multi-sector read, and the following sectors are served from the buffer.
+/  0 disables the read-ahead. Each FATFS grows by FF_DIR_READAHEAD * FF_MAX_SS
+/  bytes. It can also be set with a compile definition. */
+
+
+#ifndef FF_BATCH_FREE
+#define FF_BATCH_FREE		0
+#endif
+/* This option enables f_batchfree() and sets the number of contiguous cluster
+/  blocks each filesystem object can collect. While batching is enabled on a
+/  volume, f_unlink, f_truncate and the other functions that remove cluster
+/  chains leave the clusters allocated and add them to a sorted list, which is
+/  freed in ascending order, with each FAT sector written once, when batching
+/  is finished or the list is full. Clusters that are not freed yet (e.g. when
+/  the volume is unmounted or power is lost) are only lost clusters.
+/  0 disables the function. Each FATFS grows by FF_BATCH_FREE * 8 bytes.
+/  It can also be set with a compile definition. */
+
+
 #define FF_FS_EXFAT		1
 /* This option switches support for exFAT filesystem. (0:Disable or 1:Enable)
 /  To enable exFAT, also LFN needs to be enabled. (FF_USE_LFN >= 1)
@@ -275,7 +480,9 @@
 /      lock control is independent of re-entrancy. */
 
 
+#ifndef FF_FS_REENTRANT
 #define FF_FS_REENTRANT	0
+#endif
 #define FF_FS_TIMEOUT	1000
 /* The option FF_FS_REENTRANT switches the re-entrancy (thread safe) of the FatFs
 /  module itself. Note that regardless of this option, file access to different
@@ -289,6 +496,13 @@
 /      function, must be added to the project. Samples are available in ffsystem.c.
 /
 /  The FF_FS_TIMEOUT defines timeout period in unit of O/S time tick.
+/
+/  In this library, FF_FS_REENTRANT can also be set with a compile definition
+/  (e.g., add_compile_definitions(FF_FS_REENTRANT=1) in CMakeLists.txt).
+/  ffsystem.c implements the handlers on Pico SDK mutexes by default (OS_TYPE 5),
+/  so FF_FS_TIMEOUT is in milliseconds, and each volume has its own mutex: files
+/  on different cards can be accessed in parallel from both cores.
+/  For FreeRTOS, define OS_TYPE=3.
 */
 
 
@@ -13,6 +13,20 @@
 
 #include <stdio.h>
 
+/* Size in bytes of the stdio buffer that open_file_stream gives each stream.
+ * It is rounded down to a whole number of sectors (at least one) and limited to
+ * one cluster of the volume, since no single disk transfer spans clusters.
+ * The buffer is word aligned, so that SDIO can DMA straight from it, and is
+ * taken from the FatFs block pool when it fits in a block (see
+ * FF_MEMPOOL_BLOCK_SIZE in ffconf.h), or else from the heap. Each open stream
+ * holds its buffer, so the default is one sector; a multiple of it, such as
+ * 4096, takes longer transfers at the cost of RAM.
+ * 0 leaves the stream with the C library's default buffering.
+ * It can also be set with a compile definition. */
+#ifndef FILE_STREAM_BUF_SIZE
+#define FILE_STREAM_BUF_SIZE 512
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -0,0 +1,62 @@
+/* fmt_number.h
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+/* Allocation-free number to text conversion shared by f_printf, the iostream
+classes and printField.
+
+In the manner of C++17 std::to_chars, each fmt_* function writes the text of
+the number into [first, last), without a terminating null, and returns a
+pointer one past the last character written, or NULL if it does not fit.
+
+Decimal digits are produced two at a time from a table of digit pairs, and
+64-bit values are split into 32-bit chunks so that there is only one 64-bit
+division per eight digits. fmt_fixed needs one double multiplication and one
+conversion to an integer (plus an fma when the product is exactly halfway
+between two results); the digits are then produced with integer arithmetic,
+and the result is rounded like printf. It returns NULL for NaN, infinities
+and values whose scaled value does not fit in the 53-bit mantissa of a double
+(about 9e15 / 10^prec), so that the caller can fall back to a general
+conversion.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Largest precision that fmt_fixed accepts */
+#define FMT_FIXED_MAX_PREC 19
+
+/* Number of decimal digits in v (at least 1) */
+unsigned fmt_len_u32(uint32_t v);
+unsigned fmt_len_u64(uint64_t v);
+
+char *fmt_u32(char *first, char *last, uint32_t v);
+char *fmt_u64(char *first, char *last, uint64_t v);
+char *fmt_i32(char *first, char *last, int32_t v);
+char *fmt_i64(char *first, char *last, int64_t v);
+
+/* Decimal notation with prec fractional digits, rounded to nearest.
+No decimal point is written when prec is 0. */
+char *fmt_fixed(char *first, char *last, double v, unsigned prec);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,86 @@
+/* line_reader.h
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+/* Block-buffered line and field reader for text files such as CSV.
+
+The reader reads the file into a caller's buffer with f_read, a whole number
+of sectors at a time where it can, and finds the delimiters a word at a time.
+Lines are handed back in place: line_reader_getline returns a pointer into the
+buffer, with the delimiter replaced by a null, so nothing is copied. A line is
+valid until the next call. line_split splits a line into fields in place.
+
+Example:
+
+    static char buf[2048] __attribute__((aligned(4)));
+    line_reader_t lr;
+    line_reader_init(&lr, &fil, buf, sizeof buf);
+    char *line;
+    size_t len;
+    while ((line = line_reader_getline(&lr, '\n', &len))) {
+        char *fields[4];
+        size_t n = line_split(line, len, ',', fields, 4);
+        ...
+    }
+    if (FR_OK != lr.fr) ...
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+//
+#include "ff.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    FIL *fp;
+    char *buf;
+    size_t size;  // Size of buf
+    size_t pos;   // Start of the bytes not yet returned
+    size_t end;   // End of the bytes read into buf
+    FRESULT fr;   // Result of the last f_read
+    bool eof;
+    bool piece;   // The last line returned was a piece of a long line
+} line_reader_t;
+
+/* Read from fp, which is open for reading, into buf. Reads end on sector
+boundaries of the file, so a buffer of a few sectors, e.g. 2048 bytes, is read
+into whole sectors at a time. */
+void line_reader_init(line_reader_t *lr, FIL *fp, void *buf, size_t size);
+
+/* Get the next line, up to delim, as a null terminated string in the buffer.
+The delimiter is not included, nor is a CR before a '\n' delim. *len, if len
+is not NULL, is set to the length of the line. A line that does not fit in
+the buffer is returned in pieces of size - 1 bytes.
+Returns NULL at the end of the file or on error (lr->fr is not FR_OK). */
+char *line_reader_getline(line_reader_t *lr, char delim, size_t *len);
+
+/* Split the len bytes at line, which are followed by a null like the lines of
+line_reader_getline, into fields at each delim, in place, putting a pointer to
+each null terminated field in fields[]. When there are more than max fields,
+the last one holds the rest of the line.
+Returns the number of fields (at least 1 if max is not 0). */
+size_t line_split(char *line, size_t len, char delim, char *fields[], size_t max);
+
+/* First c in [first, last), or NULL */
+const char *line_find(const char *first, const char *last, char c);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* [] END OF FILE */
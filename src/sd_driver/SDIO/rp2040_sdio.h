@@ -73,6 +73,11 @@ typedef struct sd_sdio_if_state_t {
     // Variables for extended block writes
     bool ongoing_wr_mlt_blk;
     uint32_t wr_mlt_blk_cnt_sector;
+
+    // Variables for asynchronous block transfers (see sd_card_t::transfer_poll)
+    sdio_transfer_state_t async_op;  // SDIO_IDLE, SDIO_RX or SDIO_TX
+    uint32_t async_sector;
+    uint32_t async_blocks;
     
     // Variables for block reads
     // This is used to perform DMA into data buffers and checksum buffers separately.
@@ -326,38 +326,23 @@ bool sd_sdio_writeSector(sd_card_t *sd_card_p, uint32_t sector, const uint8_t* s
     return STATE.error == SDIO_OK;
 }
 
-bool sd_sdio_writeSectors(sd_card_t *sd_card_p, uint32_t sector, const uint8_t *src, size_t n) {
-    if (((uint32_t)src & 3) != 0) {
-        // Unaligned write, execute sector-by-sector
-        for (size_t i = 0; i < n; i++) {
-            if (!sd_sdio_writeSector(sd_card_p, sector + i, src + 512 * i)) {
-                return false;
-            }
-        }
-        return true;
-    }
+/* Start an aligned multiblock write; don't wait for it */
+static bool sd_sdio_writeSectors_start(sd_card_t *sd_card_p, uint32_t sector, const uint8_t *src, size_t n) {
     if (STATE.ongoing_wr_mlt_blk && sector == STATE.wr_mlt_blk_cnt_sector) {
         /* Continue a multiblock write */
-        if (!checkReturnOk(rp2040_sdio_tx_start(sd_card_p, src, n)))  // Start transmission
-            return false;
-    } else {
-        // Stop any previous transmission
-        if (STATE.ongoing_wr_mlt_blk) {
-            if (!sd_sdio_stopTransmission(sd_card_p, true)) return false;
-        }
-        uint32_t reply;
-        if (!checkReturnOk(rp2040_sdio_command_R1(sd_card_p, CMD25_WRITE_MULTIPLE_BLOCK, sector, &reply)) ||
-            !checkReturnOk(rp2040_sdio_tx_start(sd_card_p, src, n)))  // Start transmission
-        {
-            return false;
-        }
+        return checkReturnOk(rp2040_sdio_tx_start(sd_card_p, src, n));  // Start transmission
     }
+    // Stop any previous transmission
+    if (STATE.ongoing_wr_mlt_blk) {
+        if (!sd_sdio_stopTransmission(sd_card_p, true)) return false;
+    }
+    uint32_t reply;
+    return checkReturnOk(rp2040_sdio_command_R1(sd_card_p, CMD25_WRITE_MULTIPLE_BLOCK, sector, &reply)) &&
+           checkReturnOk(rp2040_sdio_tx_start(sd_card_p, src, n));  // Start transmission
+}
 
-    do {
-        uint32_t bytes_done;
-        STATE.error = rp2040_sdio_tx_poll(sd_card_p, &bytes_done);
-    } while (STATE.error == SDIO_BUSY);
-
+/* Called when polling reports that a write started by sd_sdio_writeSectors_start is no longer busy */
+static bool sd_sdio_writeSectors_finish(sd_card_t *sd_card_p, uint32_t sector, size_t n) {
     if (STATE.error != SDIO_OK) {
         EMSG_PRINTF("sd_sdio_writeSectors(,%lu,,%zu) failed: %s (%d)\n", sector, n, errstr(STATE.error), (int)STATE.error);
         sd_sdio_stopTransmission(sd_card_p, true);
@@ -378,6 +363,26 @@ bool sd_sdio_writeSectors(sd_card_t *sd_card_p, uint32_t sector, const uint8_t *
     */
 }
 
+bool sd_sdio_writeSectors(sd_card_t *sd_card_p, uint32_t sector, const uint8_t *src, size_t n) {
+    if (((uint32_t)src & 3) != 0) {
+        // Unaligned write, execute sector-by-sector
+        for (size_t i = 0; i < n; i++) {
+            if (!sd_sdio_writeSector(sd_card_p, sector + i, src + 512 * i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (!sd_sdio_writeSectors_start(sd_card_p, sector, src, n)) return false;
+
+    do {
+        uint32_t bytes_done;
+        STATE.error = rp2040_sdio_tx_poll(sd_card_p, &bytes_done);
+    } while (STATE.error == SDIO_BUSY);
+
+    return sd_sdio_writeSectors_finish(sd_card_p, sector, n);
+}
+
 bool sd_sdio_readSector(sd_card_t *sd_card_p, uint32_t sector, uint8_t* dst)
 {
     if (STATE.ongoing_wr_mlt_blk)
@@ -416,6 +421,31 @@ bool sd_sdio_readSector(sd_card_t *sd_card_p, uint32_t sector, uint8_t* dst)
     return STATE.error == SDIO_OK;
 }
 
+/* Start an aligned multiblock read; don't wait for it */
+static bool sd_sdio_readSectors_start(sd_card_t *sd_card_p, uint32_t sector, uint8_t* dst, size_t n)
+{
+    uint32_t reply;
+    return /* checkReturnOk(rp2040_sdio_command_R1(sd_card_p, 16, 512, &reply)) && // SET_BLOCKLEN */
+        checkReturnOk(rp2040_sdio_rx_start(sd_card_p, dst, n, SDIO_BLOCK_SIZE)) && // Prepare for reception
+        checkReturnOk(rp2040_sdio_command_R1(sd_card_p, CMD18_READ_MULTIPLE_BLOCK, sector, &reply)); // READ_MULTIPLE_BLOCK
+}
+
+/* Called when polling reports that a read started by sd_sdio_readSectors_start is no longer busy */
+static bool sd_sdio_readSectors_finish(sd_card_t *sd_card_p, uint32_t sector, size_t n)
+{
+    if (STATE.error != SDIO_OK)
+    {
+        EMSG_PRINTF("sd_sdio_readSectors(%ld,...,%d)  failed: %s (%d)\n", 
+            sector, n, errstr(STATE.error), STATE.error);
+        sd_sdio_stopTransmission(sd_card_p, true);
+        return false;
+    }
+    else
+    {
+        return sd_sdio_stopTransmission(sd_card_p, true);
+    }
+}
+
 bool sd_sdio_readSectors(sd_card_t *sd_card_p, uint32_t sector, uint8_t* dst, size_t n)
 {
     if (STATE.ongoing_wr_mlt_blk)
@@ -435,10 +465,7 @@ bool sd_sdio_readSectors(sd_card_t *sd_card_p, uint32_t sector, uint8_t* dst, si
         return true;
     }
 
-    uint32_t reply;
-    if (/* !checkReturnOk(rp2040_sdio_command_R1(sd_card_p, 16, 512, &reply)) || // SET_BLOCKLEN */
-        !checkReturnOk(rp2040_sdio_rx_start(sd_card_p, dst, n, SDIO_BLOCK_SIZE)) || // Prepare for reception
-        !checkReturnOk(rp2040_sdio_command_R1(sd_card_p, CMD18_READ_MULTIPLE_BLOCK, sector, &reply))) // READ_MULTIPLE_BLOCK
+    if (!sd_sdio_readSectors_start(sd_card_p, sector, dst, n))
     {
         return false;
     }
@@ -447,21 +474,15 @@ bool sd_sdio_readSectors(sd_card_t *sd_card_p, uint32_t sector, uint8_t* dst, si
         STATE.error = rp2040_sdio_rx_poll(sd_card_p, SDIO_WORDS_PER_BLOCK);
     } while (STATE.error == SDIO_BUSY);
 
-    if (STATE.error != SDIO_OK)
-    {
-        EMSG_PRINTF("sd_sdio_readSectors(%ld,...,%d)  failed: %s (%d)\n", 
-            sector, n, errstr(STATE.error), STATE.error);
-        sd_sdio_stopTransmission(sd_card_p, true);
-        return false;
-    }
-    else
-    {
-        return sd_sdio_stopTransmission(sd_card_p, true);
-    }
+    return sd_sdio_readSectors_finish(sd_card_p, sector, n);
 }
 
 // Get 512 bit (64 byte) SD Status
 bool rp2040_sdio_get_sd_status(sd_card_t *sd_card_p, uint8_t response[64]) {
+    if (STATE.ongoing_wr_mlt_blk)
+        // Stop any ongoing transmission
+        if (!sd_sdio_stopTransmission(sd_card_p, true)) return false;
+
     uint32_t reply;
     if (!checkReturnOk(rp2040_sdio_rx_start(sd_card_p, response, 1, 64)) || // Prepare for reception
         !checkReturnOk(rp2040_sdio_command_R1(sd_card_p, CMD55_APP_CMD, STATE.rca, &reply)) ||  // APP_CMD
@@ -562,6 +583,11 @@ static DSTATUS sd_sdio_init(sd_card_t *sd_card_p) {
     if (ok) {
         // The card is now initialized
         sd_card_p->state.m_Status &= ~STA_NOINIT;
+
+        // Read the Allocation Unit now, for sd_allocation_unit to return
+        uint8_t status[64] = {0};
+        sd_card_p->state.au_size_bytes =
+            rp2040_sdio_get_sd_status(sd_card_p, status) ? sd_status_au_size(status) : 0;
     }
     sd_unlock(sd_card_p);
     return sd_card_p->state.m_Status;
@@ -627,6 +653,64 @@ static block_dev_err_t sd_sdio_read_blocks(sd_card_t *sd_card_p, uint8_t *buffer
     else
         return SD_BLOCK_DEVICE_ERROR_NO_RESPONSE;
 }
+static block_dev_err_t sd_sdio_write_blocks_start(sd_card_t *sd_card_p, const uint8_t *buffer,
+                                                  uint32_t ulSectorNumber, uint32_t blockCnt) {
+    if (((uint32_t)buffer & 3) != 0)
+        // Unaligned: can't DMA straight from the buffer, so do it synchronously
+        return sd_sdio_write_blocks(sd_card_p, buffer, ulSectorNumber, blockCnt);
+
+    sd_lock(sd_card_p);
+    if (!sd_sdio_writeSectors_start(sd_card_p, ulSectorNumber, buffer, blockCnt)) {
+        sd_unlock(sd_card_p);
+        return SD_BLOCK_DEVICE_ERROR_WRITE;
+    }
+    STATE.async_op = SDIO_TX;
+    STATE.async_sector = ulSectorNumber;
+    STATE.async_blocks = blockCnt;
+    return SD_BLOCK_DEVICE_ERROR_NONE;  // Still locked until sd_sdio_transfer_poll is done
+}
+static block_dev_err_t sd_sdio_read_blocks_start(sd_card_t *sd_card_p, uint8_t *buffer,
+                                                 uint32_t ulSectorNumber, uint32_t ulSectorCount) {
+    if (((uint32_t)buffer & 3) != 0 || ulSectorNumber + ulSectorCount >= sd_card_p->state.sectors)
+        // Unaligned read or end-of-drive read: do it synchronously
+        return sd_sdio_read_blocks(sd_card_p, buffer, ulSectorNumber, ulSectorCount);
+
+    sd_lock(sd_card_p);
+    if ((STATE.ongoing_wr_mlt_blk && !sd_sdio_stopTransmission(sd_card_p, true)) ||
+        !sd_sdio_readSectors_start(sd_card_p, ulSectorNumber, buffer, ulSectorCount)) {
+        sd_unlock(sd_card_p);
+        return SD_BLOCK_DEVICE_ERROR_NO_RESPONSE;
+    }
+    STATE.async_op = SDIO_RX;
+    STATE.async_sector = ulSectorNumber;
+    STATE.async_blocks = ulSectorCount;
+    return SD_BLOCK_DEVICE_ERROR_NONE;  // Still locked until sd_sdio_transfer_poll is done
+}
+static block_dev_err_t sd_sdio_transfer_poll(sd_card_t *sd_card_p) {
+    block_dev_err_t rc;
+    switch (STATE.async_op) {
+        case SDIO_TX: {
+            uint32_t bytes_done;
+            STATE.error = rp2040_sdio_tx_poll(sd_card_p, &bytes_done);
+            if (SDIO_BUSY == STATE.error) return SD_BLOCK_DEVICE_ERROR_WOULD_BLOCK;
+            bool ok = sd_sdio_writeSectors_finish(sd_card_p, STATE.async_sector, STATE.async_blocks);
+            rc = ok ? SD_BLOCK_DEVICE_ERROR_NONE : SD_BLOCK_DEVICE_ERROR_WRITE;
+            break;
+        }
+        case SDIO_RX: {
+            STATE.error = rp2040_sdio_rx_poll(sd_card_p, SDIO_WORDS_PER_BLOCK);
+            if (SDIO_BUSY == STATE.error) return SD_BLOCK_DEVICE_ERROR_WOULD_BLOCK;
+            bool ok = sd_sdio_readSectors_finish(sd_card_p, STATE.async_sector, STATE.async_blocks);
+            rc = ok ? SD_BLOCK_DEVICE_ERROR_NONE : SD_BLOCK_DEVICE_ERROR_NO_RESPONSE;
+            break;
+        }
+        default:
+            return SD_BLOCK_DEVICE_ERROR_NONE;  // Nothing in progress
+    }
+    STATE.async_op = SDIO_IDLE;
+    sd_unlock(sd_card_p);
+    return rc;
+}
 static block_dev_err_t sd_sync(sd_card_t *sd_card_p) {
     sd_lock(sd_card_p);
     block_dev_err_t err = SD_BLOCK_DEVICE_ERROR_NONE;
@@ -660,5 +744,8 @@ void sd_sdio_ctor(sd_card_t *sd_card_p) {
     sd_card_p->read_blocks = sd_sdio_read_blocks;
     sd_card_p->sync = sd_sync;
     sd_card_p->get_num_sectors = sd_sdio_sectorCount;
+    sd_card_p->write_blocks_start = sd_sdio_write_blocks_start;
+    sd_card_p->read_blocks_start = sd_sdio_read_blocks_start;
+    sd_card_p->transfer_poll = sd_sdio_transfer_poll;
     sd_card_p->sd_test_com = sd_sdio_test_com;
 }
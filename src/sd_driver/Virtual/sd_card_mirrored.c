@@ -0,0 +1,507 @@
+/* sd_card_mirrored.c
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+#include <stdint.h>
+#include <string.h>
+//
+#include "pico/critical_section.h"
+#include "pico/mutex.h"
+#include "pico/time.h"
+//
+#include "my_debug.h"
+#include "sd_card.h"
+//
+#include "sd_card_mirrored.h"
+
+#define TRACE_PRINTF(fmt, args...)
+// #define TRACE_PRINTF printf
+
+#define NO_MEMBER 2
+
+/* The last block of each member holds a mirror record.
+A member whose record has the highest generation holds a good copy. The
+generation goes up whenever a member stops being in sync, so a member that
+missed writes is left with an older one. Members with the same generation
+are identical if their records are also marked clean: the record is marked
+dirty before the first write after a clean mark, and clean again by a sync. */
+#define MIRROR_MAGIC 0x524D4453  // "SDMR"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t generation;
+    uint32_t sectors;  // Size of the mirrored card
+    uint32_t clean;
+    uint32_t check;
+} mirror_record_t;
+
+// Shared by all mirrors
+static uint8_t record_buf[512] __attribute__((aligned(4)));
+auto_init_mutex(record_mutex);
+
+static uint32_t record_check(mirror_record_t const *rec_p) {
+    return ~(rec_p->magic ^ rec_p->generation ^ rec_p->sectors ^ rec_p->clean);
+}
+
+static bool usable(DSTATUS status) { return !(status & (STA_NOINIT | STA_NODISK)); }
+
+static uint32_t record_lba(sd_card_t *member_p) { return member_p->get_num_sectors(member_p) - 1; }
+
+static bool get_record(sd_card_t *member_p, mirror_record_t *rec_p) {
+    mutex_enter_blocking(&record_mutex);
+    bool ok = SD_BLOCK_DEVICE_ERROR_NONE ==
+              member_p->read_blocks(member_p, record_buf, record_lba(member_p), 1);
+    if (ok) memcpy(rec_p, record_buf, sizeof *rec_p);
+    mutex_exit(&record_mutex);
+    return ok && MIRROR_MAGIC == rec_p->magic && record_check(rec_p) == rec_p->check;
+}
+
+static bool put_record(sd_mirrored_if_t *if_p, sd_card_t *member_p, uint32_t sectors, bool clean) {
+    mirror_record_t rec = {.magic = MIRROR_MAGIC,
+                           .generation = if_p->state.generation,
+                           .sectors = sectors,
+                           .clean = clean};
+    rec.check = record_check(&rec);
+    mutex_enter_blocking(&record_mutex);
+    memset(record_buf, 0, sizeof record_buf);
+    memcpy(record_buf, &rec, sizeof rec);
+    bool ok = SD_BLOCK_DEVICE_ERROR_NONE ==
+                  member_p->write_blocks(member_p, record_buf, record_lba(member_p), 1) &&
+              SD_BLOCK_DEVICE_ERROR_NONE == member_p->sync(member_p);
+    mutex_exit(&record_mutex);
+    return ok;
+}
+
+static void busy_add(sd_mirrored_if_t *if_p, size_t member, int delta) {
+    critical_section_enter_blocking(&if_p->state.cs);
+    if_p->state.busy[member] += delta;
+    critical_section_exit(&if_p->state.cs);
+}
+
+/* Can member supply blocks [lba, lba + count)? */
+static bool readable(sd_mirrored_if_t const *if_p, size_t member, uint32_t lba, uint32_t count) {
+    return if_p->state.in_sync[member] ||
+           (if_p->state.resyncing[member] && lba + count <= if_p->state.resync_lba);
+}
+
+/* Choose the member for a read and count it as busy */
+static size_t pick_reader(sd_mirrored_if_t *if_p, uint32_t lba, uint32_t count) {
+    bool ok0 = readable(if_p, 0, lba, count);
+    bool ok1 = readable(if_p, 1, lba, count);
+    size_t m;
+    critical_section_enter_blocking(&if_p->state.cs);
+    if (ok0 && ok1) {
+        if (if_p->state.busy[0] != if_p->state.busy[1])
+            m = if_p->state.busy[0] < if_p->state.busy[1] ? 0 : 1;
+        else
+            m = !if_p->state.last_read;  // Alternate
+    } else if (ok0) {
+        m = 0;
+    } else if (ok1) {
+        m = 1;
+    } else {
+        critical_section_exit(&if_p->state.cs);
+        return NO_MEMBER;
+    }
+    ++if_p->state.busy[m];
+    if_p->state.last_read = m;
+    critical_section_exit(&if_p->state.cs);
+    return m;
+}
+
+/* Take member out of the mirror. A member that was in sync leaves the
+others with a newer generation, which write_records must then store. */
+static void drop(sd_mirrored_if_t *if_p, size_t member) {
+    if (if_p->state.in_sync[member] || if_p->state.resyncing[member])
+        EMSG_PRINTF("Mirror member %zu failed; continuing without it\n", member);
+    if (if_p->state.in_sync[member]) ++if_p->state.generation;
+    if_p->state.in_sync[member] = false;
+    if_p->state.resyncing[member] = false;
+}
+
+/* Store the current generation on the members that are in sync,
+dropping any that can't be written */
+static void write_records(sd_card_t *sd_card_p, bool clean) {
+    sd_mirrored_if_t *if_p = sd_card_p->mirrored_if_p;
+    for (size_t i = 0; i < count_of(if_p->members); ++i) {
+        if (!if_p->state.in_sync[i]) continue;
+        if (!put_record(if_p, if_p->members[i], sd_card_p->state.sectors, clean)) {
+            drop(if_p, i);
+            i = SIZE_MAX;  // Start over with the new generation
+        }
+    }
+    if_p->state.dirty = !clean;
+    if_p->state.dirty_ms = to_ms_since_boot(get_absolute_time());
+}
+
+/* Start rebuilding member from the other one, which is in sync */
+static void admit(sd_card_t *sd_card_p, size_t member) {
+    sd_mirrored_if_t *if_p = sd_card_p->mirrored_if_p;
+    IMSG_PRINTF("Rebuilding mirror member %zu\n", member);
+    if_p->state.resyncing[member] = true;
+    if_p->state.resync_lba = 0;
+}
+
+/* At the first initialization, find out from the records which members
+are in sync. Returns false if no member can be used. */
+static bool join(sd_card_t *sd_card_p) {
+    sd_mirrored_if_t *if_p = sd_card_p->mirrored_if_p;
+    bool up[2] = {false}, valid[2] = {false};
+    mirror_record_t recs[2];
+    uint32_t n[2] = {0};
+    size_t src = NO_MEMBER;
+    for (size_t i = 0; i < count_of(if_p->members); ++i) {
+        sd_card_t *member_p = if_p->members[i];
+        if_p->state.in_sync[i] = false;
+        if_p->state.resyncing[i] = false;
+        up[i] = usable(member_p->init(member_p));
+        if (!up[i]) continue;
+        n[i] = record_lba(member_p);  // Blocks available to the mirror
+        valid[i] = get_record(member_p, &recs[i]) && recs[i].sectors <= n[i];
+        if (valid[i] && (NO_MEMBER == src || recs[i].generation > recs[src].generation))
+            src = i;
+    }
+    bool fresh = NO_MEMBER == src;  // No records: a new mirror
+    if (fresh) {
+        src = up[0] ? 0 : up[1] ? 1 : NO_MEMBER;
+        if (NO_MEMBER == src) return false;
+        sd_card_p->state.sectors = n[src];
+        if_p->state.generation = 1;
+    } else {
+        sd_card_p->state.sectors = recs[src].sectors;
+        if_p->state.generation = recs[src].generation;
+    }
+    if_p->state.in_sync[src] = true;
+    size_t other = !src;
+    if (up[other] && n[other] >= sd_card_p->state.sectors) {
+        if (fresh ? if_p->assume_in_sync
+                  : valid[other] && recs[other].generation == recs[src].generation &&
+                        recs[other].clean && recs[src].clean) {
+            if_p->state.in_sync[other] = true;
+        } else {
+            admit(sd_card_p, other);
+        }
+    }
+    // The others, if any, no longer match the records on the members in sync
+    if (!if_p->state.in_sync[other]) ++if_p->state.generation;
+    write_records(sd_card_p, true);
+    return if_p->state.in_sync[0] || if_p->state.in_sync[1];
+}
+
+/* The first call finds the members that are in sync from their records.
+Later calls bring back members that have been dropped (e.g., a card that was
+missing or slow at startup) by rebuilding them from the one in sync. */
+static DSTATUS sd_mirrored_init(sd_card_t *sd_card_p) {
+    sd_mirrored_if_t *if_p = sd_card_p->mirrored_if_p;
+    sd_lock(sd_card_p);
+    bool any = false;
+    if (sd_card_p->state.m_Status & STA_NOINIT) {
+        any = join(sd_card_p);
+    } else {
+        bool dropped = false;
+        for (size_t i = 0; i < count_of(if_p->members); ++i) {
+            sd_card_t *member_p = if_p->members[i];
+            bool ok = usable(member_p->init(member_p));
+            if (!ok && if_p->state.in_sync[i]) dropped = true;
+            if (!ok) drop(if_p, i);
+        }
+        if (dropped) write_records(sd_card_p, !if_p->state.dirty);
+        for (size_t i = 0; i < count_of(if_p->members); ++i) {
+            sd_card_t *member_p = if_p->members[i];
+            if (if_p->state.in_sync[i]) any = true;
+            else if (!if_p->state.resyncing[i] && if_p->state.in_sync[!i] &&
+                     usable(member_p->state.m_Status) &&
+                     record_lba(member_p) >= sd_card_p->state.sectors)
+                admit(sd_card_p, i);
+        }
+    }
+    if (any) {
+        sd_card_p->state.card_type = if_p->members[0]->state.card_type;
+        sd_card_p->state.m_Status &= ~STA_NOINIT;
+    } else {
+        sd_card_p->state.sectors = 0;
+        sd_card_p->state.m_Status |= STA_NOINIT;
+    }
+    sd_unlock(sd_card_p);
+    return sd_card_p->state.m_Status;
+}
+
+static void sd_mirrored_deinit(sd_card_t *sd_card_p) {
+    sd_mirrored_if_t *if_p = sd_card_p->mirrored_if_p;
+    sd_lock(sd_card_p);
+    for (size_t i = 0; i < count_of(if_p->members); ++i)
+        if_p->members[i]->deinit(if_p->members[i]);
+    sd_card_p->state.m_Status |= STA_NOINIT;
+    sd_card_p->state.card_type = SDCARD_NONE;
+    sd_unlock(sd_card_p);
+}
+
+static block_dev_err_t check_range(sd_card_t *sd_card_p, uint32_t lba, uint32_t count) {
+    if (!usable(sd_card_p->state.m_Status)) return SD_BLOCK_DEVICE_ERROR_NO_INIT;
+    if (lba + count > sd_card_p->state.sectors || lba + count < lba)
+        return SD_BLOCK_DEVICE_ERROR_PARAMETER;
+    return SD_BLOCK_DEVICE_ERROR_NONE;
+}
+
+/* Reads don't take the lock on the virtual card,
+so that reads can proceed on both members at once. */
+static block_dev_err_t sd_mirrored_read_blocks(sd_card_t *sd_card_p, uint8_t *buffer,
+                                               uint32_t ulSectorNumber, uint32_t ulSectorCount) {
+    sd_mirrored_if_t *if_p = sd_card_p->mirrored_if_p;
+    block_dev_err_t rc = check_range(sd_card_p, ulSectorNumber, ulSectorCount);
+    if (SD_BLOCK_DEVICE_ERROR_NONE != rc) return rc;
+
+    // Large read: half from each member
+    if (ulSectorCount >= 2 * SD_MIRRORED_SPLIT_BLOCKS &&
+        readable(if_p, 0, ulSectorNumber, ulSectorCount) &&
+        readable(if_p, 1, ulSectorNumber, ulSectorCount)) {
+        uint32_t half = ulSectorCount / 2;
+        sd_xfer_t xfers[] = {
+            {.sd_card_p = if_p->members[0], .write = false, .buffer = buffer,
+             .sector = ulSectorNumber, .count = half},
+            {.sd_card_p = if_p->members[1], .write = false, .buffer = buffer + half * sd_block_size,
+             .sector = ulSectorNumber + half, .count = ulSectorCount - half}};
+        busy_add(if_p, 0, 1);
+        busy_add(if_p, 1, 1);
+        rc = sd_transfer_concurrent(xfers, count_of(xfers));
+        busy_add(if_p, 0, -1);
+        busy_add(if_p, 1, -1);
+        if (SD_BLOCK_DEVICE_ERROR_NONE == rc) return rc;
+        // Otherwise, fall back to reading it all from one member
+    }
+    size_t m = pick_reader(if_p, ulSectorNumber, ulSectorCount);
+    if (NO_MEMBER == m) return SD_BLOCK_DEVICE_ERROR_NO_DEVICE;
+    TRACE_PRINTF("%s: sector=%lu count=%lu member=%zu\n", __func__, ulSectorNumber,
+                 ulSectorCount, m);
+    rc = if_p->members[m]->read_blocks(if_p->members[m], buffer, ulSectorNumber, ulSectorCount);
+    busy_add(if_p, m, -1);
+    size_t other = !m;
+    if (SD_BLOCK_DEVICE_ERROR_NONE != rc && readable(if_p, other, ulSectorNumber, ulSectorCount)) {
+        EMSG_PRINTF("%s: read failed on mirror member %zu; trying the other\n", __func__, m);
+        busy_add(if_p, other, 1);
+        rc = if_p->members[other]->read_blocks(if_p->members[other], buffer, ulSectorNumber,
+                                               ulSectorCount);
+        busy_add(if_p, other, -1);
+    }
+    return rc;
+}
+
+static block_dev_err_t sd_mirrored_write_blocks(sd_card_t *sd_card_p, const uint8_t *buffer,
+                                                uint32_t ulSectorNumber, uint32_t blockCnt) {
+    sd_mirrored_if_t *if_p = sd_card_p->mirrored_if_p;
+    block_dev_err_t rc = check_range(sd_card_p, ulSectorNumber, blockCnt);
+    if (SD_BLOCK_DEVICE_ERROR_NONE != rc) return rc;
+
+    sd_lock(sd_card_p);
+    // A power failure from here until the next clean mark calls for a rebuild
+    if (!if_p->state.dirty) write_records(sd_card_p, false);
+    sd_xfer_t xfers[2];
+    size_t members[2];
+    size_t n = 0;
+    for (size_t i = 0; i < count_of(if_p->members); ++i) {
+        // A member being resynced must see writes behind and ahead of the copy
+        if (!if_p->state.in_sync[i] && !if_p->state.resyncing[i]) continue;
+        xfers[n] = (sd_xfer_t){.sd_card_p = if_p->members[i], .write = true,
+                               .buffer = (uint8_t *)buffer, .sector = ulSectorNumber,
+                               .count = blockCnt};
+        members[n++] = i;
+        busy_add(if_p, i, 1);
+    }
+    if (!n) {
+        sd_unlock(sd_card_p);
+        return SD_BLOCK_DEVICE_ERROR_NO_DEVICE;
+    }
+    sd_transfer_concurrent(xfers, n);
+
+    // Succeed if at least one complete copy was written
+    rc = xfers[0].status;
+    bool written = false, dropped = false;
+    for (size_t i = 0; i < n; ++i) {
+        busy_add(if_p, members[i], -1);
+        if (SD_BLOCK_DEVICE_ERROR_NONE != xfers[i].status) {
+            if (if_p->state.in_sync[members[i]]) dropped = true;
+            drop(if_p, members[i]);
+        } else if (if_p->state.in_sync[members[i]]) {
+            written = true;
+        }
+    }
+    // The failed member must not pass for a good copy at the next startup
+    if (dropped && written) write_records(sd_card_p, false);
+    if (written) rc = SD_BLOCK_DEVICE_ERROR_NONE;
+    else if (SD_BLOCK_DEVICE_ERROR_NONE == rc) rc = SD_BLOCK_DEVICE_ERROR_NO_DEVICE;
+    sd_unlock(sd_card_p);
+    return rc;
+}
+
+static block_dev_err_t sd_mirrored_sync(sd_card_t *sd_card_p) {
+    sd_mirrored_if_t *if_p = sd_card_p->mirrored_if_p;
+    block_dev_err_t rc = SD_BLOCK_DEVICE_ERROR_NO_DEVICE;
+    sd_lock(sd_card_p);
+    for (size_t i = 0; i < count_of(if_p->members); ++i) {
+        if (!if_p->state.in_sync[i] && !if_p->state.resyncing[i]) continue;
+        block_dev_err_t member_rc = if_p->members[i]->sync(if_p->members[i]);
+        if (SD_BLOCK_DEVICE_ERROR_NO_DEVICE == rc || SD_BLOCK_DEVICE_ERROR_NONE != member_rc)
+            rc = member_rc;
+    }
+    /* Mark the members clean, so that the next startup needs no rebuild,
+    at most once per SD_MIRRORED_CLEAN_DELAY_MS of writing */
+    if (SD_BLOCK_DEVICE_ERROR_NONE == rc && if_p->state.dirty &&
+        to_ms_since_boot(get_absolute_time()) - if_p->state.dirty_ms >= SD_MIRRORED_CLEAN_DELAY_MS)
+        write_records(sd_card_p, true);
+    sd_unlock(sd_card_p);
+    return rc;
+}
+
+static uint32_t sd_mirrored_get_num_sectors(sd_card_t *sd_card_p) {
+    return sd_card_p->state.sectors;
+}
+
+static bool sd_mirrored_test_com(sd_card_t *sd_card_p) {
+    sd_mirrored_if_t *if_p = sd_card_p->mirrored_if_p;
+    bool any = false;
+    for (size_t i = 0; i < count_of(if_p->members); ++i)
+        if (if_p->members[i]->sd_test_com(if_p->members[i]) && if_p->state.in_sync[i])
+            any = true;
+    if (!any) sd_card_p->state.m_Status |= STA_NOINIT;
+    return any;
+}
+
+bool sd_mirrored_in_sync(sd_card_t *sd_card_p, size_t member) {
+    myASSERT(SD_IF_MIRRORED == sd_card_p->type);
+    myASSERT(member < count_of(sd_card_p->mirrored_if_p->members));
+    return sd_card_p->mirrored_if_p->state.in_sync[member];
+}
+
+bool sd_mirrored_resync_start(sd_card_t *sd_card_p, size_t member) {
+    myASSERT(SD_IF_MIRRORED == sd_card_p->type);
+    sd_mirrored_if_t *if_p = sd_card_p->mirrored_if_p;
+    myASSERT(member < count_of(if_p->members));
+    sd_card_t *target_p = if_p->members[member];
+    bool ok = false;
+
+    sd_lock(sd_card_p);
+    if (!if_p->state.in_sync[!member]) {
+        EMSG_PRINTF("%s: no good copy to resync from\n", __func__);
+    } else if (!usable(target_p->init(target_p))) {
+        EMSG_PRINTF("%s: can't initialize mirror member %zu\n", __func__, member);
+    } else if (record_lba(target_p) < sd_card_p->state.sectors) {
+        EMSG_PRINTF("%s: mirror member %zu is too small\n", __func__, member);
+    } else {
+        if (if_p->state.in_sync[member]) {
+            ++if_p->state.generation;
+            if_p->state.in_sync[member] = false;
+            write_records(sd_card_p, !if_p->state.dirty);
+        }
+        admit(sd_card_p, member);
+        ok = true;
+    }
+    sd_unlock(sd_card_p);
+    return ok;
+}
+
+bool sd_mirrored_resync_step(sd_card_t *sd_card_p) {
+    myASSERT(SD_IF_MIRRORED == sd_card_p->type);
+    sd_mirrored_if_t *if_p = sd_card_p->mirrored_if_p;
+    // Shared by all mirrors
+    static uint8_t buf[SD_MIRRORED_RESYNC_BLOCKS * 512] __attribute__((aligned(4)));
+    auto_init_mutex(buf_mutex);
+
+    sd_lock(sd_card_p);  // Hold off writes while a piece is copied
+    size_t m;
+    for (m = 0; m < count_of(if_p->members); ++m)
+        if (if_p->state.resyncing[m]) break;
+    // Nothing can be copied until the volume has been initialized (e.g., mounted)
+    if (m == count_of(if_p->members) || (sd_card_p->state.m_Status & STA_NOINIT)) {
+        sd_unlock(sd_card_p);
+        return false;
+    }
+    if (!if_p->state.in_sync[!m]) {
+        EMSG_PRINTF("%s: no good copy to resync from; resync abandoned\n", __func__);
+        if_p->state.resyncing[m] = false;
+        sd_unlock(sd_card_p);
+        return false;
+    }
+    sd_card_t *src_p = if_p->members[!m];
+    sd_card_t *dst_p = if_p->members[m];
+    uint32_t lba = if_p->state.resync_lba;
+    uint32_t count = sd_card_p->state.sectors - lba;
+    if (count > SD_MIRRORED_RESYNC_BLOCKS) count = SD_MIRRORED_RESYNC_BLOCKS;
+
+    mutex_enter_blocking(&buf_mutex);
+    block_dev_err_t rc = src_p->read_blocks(src_p, buf, lba, count);
+    if (SD_BLOCK_DEVICE_ERROR_NONE == rc) {
+        rc = dst_p->write_blocks(dst_p, buf, lba, count);
+        if (SD_BLOCK_DEVICE_ERROR_NONE != rc) drop(if_p, m);
+    } else {
+        EMSG_PRINTF("%s: read failed at sector %lu; resync abandoned\n", __func__, lba);
+        if_p->state.resyncing[m] = false;
+    }
+    mutex_exit(&buf_mutex);
+
+    if (SD_BLOCK_DEVICE_ERROR_NONE == rc) {
+        if_p->state.resync_lba = lba + count;
+        if (if_p->state.resync_lba >= sd_card_p->state.sectors) {
+            if_p->state.resyncing[m] = false;
+            // The same record as the member in sync
+            if (put_record(if_p, dst_p, sd_card_p->state.sectors, !if_p->state.dirty)) {
+                if_p->state.in_sync[m] = true;
+                IMSG_PRINTF("Mirror member %zu resync complete\n", m);
+            } else {
+                drop(if_p, m);
+            }
+        }
+    }
+    bool more = if_p->state.resyncing[m];
+    sd_unlock(sd_card_p);
+    return more;
+}
+
+bool sd_mirrored_ctor(sd_card_t *sd_card_p) {
+    sd_mirrored_if_t *if_p = sd_card_p->mirrored_if_p;
+    myASSERT(if_p);  // Must have an interface object
+    myASSERT(!sd_card_p->use_card_detect);  // Members have their own card detect
+
+    bool ok = true;
+    for (size_t i = 0; i < count_of(if_p->members); ++i) {
+        sd_card_t *member_p = if_p->members[i];
+        myASSERT(member_p && member_p != sd_card_p);
+        if (!sd_card_ctor(member_p)) ok = false;
+        if_p->state.busy[i] = 0;
+    }
+    // Which members are in sync is found from their records at the first init
+    for (size_t i = 0; i < count_of(if_p->members); ++i) {
+        if_p->state.in_sync[i] = false;
+        if_p->state.resyncing[i] = false;
+    }
+    if_p->state.resync_lba = 0;
+    if_p->state.generation = 0;
+    if_p->state.dirty = false;
+    if (!critical_section_is_initialized(&if_p->state.cs))
+        critical_section_init(&if_p->state.cs);
+    sd_card_p->state.m_Status = STA_NOINIT;
+    sd_card_p->state.sectors = 0;
+
+    sd_card_p->init = sd_mirrored_init;
+    sd_card_p->deinit = sd_mirrored_deinit;
+    sd_card_p->write_blocks = sd_mirrored_write_blocks;
+    sd_card_p->read_blocks = sd_mirrored_read_blocks;
+    sd_card_p->sync = sd_mirrored_sync;
+    sd_card_p->get_num_sectors = sd_mirrored_get_num_sectors;
+    sd_card_p->write_blocks_start = NULL;
+    sd_card_p->read_blocks_start = NULL;
+    sd_card_p->transfer_poll = NULL;
+    sd_card_p->sd_test_com = sd_mirrored_test_com;
+    return ok;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,89 @@
+/* sd_card_mirrored.h
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+/* Mirrored (RAID-1) virtual card.
+
+Presents two physical cards holding identical contents as one sd_card_t.
+Writes go to both members concurrently. Each read goes to whichever member
+has fewer transfers in progress (alternating when they are equally busy), and
+large reads are split between the two members, so reads can run at up to
+twice the speed of one card. If a read fails on one member, it is retried on
+the other. If a write fails on one member, that member is dropped and the
+volume carries on with the other one.
+
+The last block of each member holds a record of the mirror (so the mirrored
+card is one block smaller than the smaller member): a generation number,
+which goes up whenever a member drops out, and a clean mark, which is cleared
+before the first write and set again by a sync (at most once per
+SD_MIRRORED_CLEAN_DELAY_MS). At the first initialization, the member with the
+newest record is the good copy. The other member is in sync if its record
+matches and both are clean; otherwise, e.g., after a power failure during
+writes or after it missed writes, it starts out being rebuilt from the good
+copy (reads of the part not yet rebuilt go to the good copy). On new cards,
+with no records, members[0] (the primary) is the good copy, unless the
+configuration sets assume_in_sync.
+
+A member that can't be initialized or fails a write is dropped. Each later
+initialization of the mirrored card (e.g., each mount) retries a dropped
+member and, if it comes up, starts rebuilding it; sd_mirrored_resync_start
+does the same for a replaced member. The rebuild is driven by repeated calls
+to sd_mirrored_resync_step (e.g., from the idle loop or a low priority task),
+which copy the good member to it a little at a time while the volume stays
+in use.
+*/
+
+#pragma once
+
+#include "sd_card.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Reads of at least twice this many blocks are split between the members */
+#ifndef SD_MIRRORED_SPLIT_BLOCKS
+#  define SD_MIRRORED_SPLIT_BLOCKS 8
+#endif
+
+/* A sync marks the members clean at most this often while they are written */
+#ifndef SD_MIRRORED_CLEAN_DELAY_MS
+#  define SD_MIRRORED_CLEAN_DELAY_MS 1000
+#endif
+
+/* Number of blocks copied by each sd_mirrored_resync_step */
+#ifndef SD_MIRRORED_RESYNC_BLOCKS
+#  define SD_MIRRORED_RESYNC_BLOCKS 32
+#endif
+
+bool sd_mirrored_ctor(sd_card_t *sd_card_p);  // Constructor for sd_card_t
+
+/* True if and only if member (0 or 1) holds a complete copy */
+bool sd_mirrored_in_sync(sd_card_t *sd_card_p, size_t member);
+
+/* Begin rebuilding member (0 or 1) from the other member,
+e.g., after a failed card has been replaced.
+Returns false if the other member isn't in sync
+or the member can't be initialized or is too small. */
+bool sd_mirrored_resync_start(sd_card_t *sd_card_p, size_t member);
+
+/* Copy the next SD_MIRRORED_RESYNC_BLOCKS blocks.
+Returns true while there is more to do. Does nothing, and returns false,
+until the mirrored card has been initialized (e.g., by mounting it). */
+bool sd_mirrored_resync_step(sd_card_t *sd_card_p);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,163 @@
+/* sd_card_striped.c
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+#include <stdint.h>
+//
+#include "my_debug.h"
+#include "sd_card.h"
+//
+#include "sd_card_striped.h"
+
+#define TRACE_PRINTF(fmt, args...)
+// #define TRACE_PRINTF printf
+
+static DSTATUS sd_striped_init(sd_card_t *sd_card_p) {
+    sd_striped_if_t *if_p = sd_card_p->striped_if_p;
+    sd_lock(sd_card_p);
+    DSTATUS status = 0;
+    uint32_t smallest = UINT32_MAX;
+    for (size_t i = 0; i < if_p->num_members; ++i) {
+        sd_card_t *member_p = if_p->members[i];
+        status |= member_p->init(member_p);
+        if (!(status & (STA_NOINIT | STA_NODISK))) {
+            uint32_t sectors = member_p->get_num_sectors(member_p);
+            if (sectors < smallest) smallest = sectors;
+        }
+    }
+    if (status & (STA_NOINIT | STA_NODISK)) {
+        sd_card_p->state.sectors = 0;
+        status |= STA_NOINIT;
+    } else {
+        uint32_t stripes = smallest / if_p->stripe_blocks;
+        sd_card_p->state.sectors = stripes * if_p->stripe_blocks * if_p->num_members;
+        sd_card_p->state.card_type = if_p->members[0]->state.card_type;
+    }
+    sd_card_p->state.m_Status = status;
+    sd_unlock(sd_card_p);
+    return status;
+}
+
+static void sd_striped_deinit(sd_card_t *sd_card_p) {
+    sd_striped_if_t *if_p = sd_card_p->striped_if_p;
+    sd_lock(sd_card_p);
+    for (size_t i = 0; i < if_p->num_members; ++i)
+        if_p->members[i]->deinit(if_p->members[i]);
+    sd_card_p->state.m_Status |= STA_NOINIT;
+    sd_card_p->state.card_type = SDCARD_NONE;
+    sd_unlock(sd_card_p);
+}
+
+/* Split the transfer on stripe boundaries. Consecutive stripes belong to
+different members, so up to num_members pieces at a time can be given to
+sd_transfer_concurrent. */
+static block_dev_err_t transfer(sd_card_t *sd_card_p, bool write, uint8_t *buffer,
+                                uint32_t lba, uint32_t count) {
+    sd_striped_if_t *if_p = sd_card_p->striped_if_p;
+    if (sd_card_p->state.m_Status & (STA_NOINIT | STA_NODISK))
+        return SD_BLOCK_DEVICE_ERROR_NO_INIT;
+    if (lba + count > sd_card_p->state.sectors || lba + count < lba)
+        return SD_BLOCK_DEVICE_ERROR_PARAMETER;
+
+    block_dev_err_t rc = SD_BLOCK_DEVICE_ERROR_NONE;
+    sd_lock(sd_card_p);
+    while (count && SD_BLOCK_DEVICE_ERROR_NONE == rc) {
+        sd_xfer_t xfers[SD_STRIPED_MAX_MEMBERS];
+        size_t n = 0;
+        while (count && n < if_p->num_members) {
+            uint32_t stripe = lba / if_p->stripe_blocks;
+            uint32_t offset = lba % if_p->stripe_blocks;
+            uint32_t blocks = if_p->stripe_blocks - offset;
+            if (blocks > count) blocks = count;
+            xfers[n].sd_card_p = if_p->members[stripe % if_p->num_members];
+            xfers[n].write = write;
+            xfers[n].buffer = buffer;
+            xfers[n].sector = (stripe / if_p->num_members) * if_p->stripe_blocks + offset;
+            xfers[n].count = blocks;
+            TRACE_PRINTF("%s: lba=%lu -> member %u sector %lu blocks %lu\n", __func__, lba,
+                         stripe % if_p->num_members, xfers[n].sector, blocks);
+            ++n;
+            buffer += blocks * sd_block_size;
+            lba += blocks;
+            count -= blocks;
+        }
+        rc = sd_transfer_concurrent(xfers, n);
+    }
+    sd_unlock(sd_card_p);
+    return rc;
+}
+
+static block_dev_err_t sd_striped_write_blocks(sd_card_t *sd_card_p, const uint8_t *buffer,
+                                               uint32_t ulSectorNumber, uint32_t blockCnt) {
+    return transfer(sd_card_p, true, (uint8_t *)buffer, ulSectorNumber, blockCnt);
+}
+
+static block_dev_err_t sd_striped_read_blocks(sd_card_t *sd_card_p, uint8_t *buffer,
+                                              uint32_t ulSectorNumber, uint32_t ulSectorCount) {
+    return transfer(sd_card_p, false, buffer, ulSectorNumber, ulSectorCount);
+}
+
+static block_dev_err_t sd_striped_sync(sd_card_t *sd_card_p) {
+    sd_striped_if_t *if_p = sd_card_p->striped_if_p;
+    block_dev_err_t rc = SD_BLOCK_DEVICE_ERROR_NONE;
+    for (size_t i = 0; i < if_p->num_members; ++i) {
+        block_dev_err_t member_rc = if_p->members[i]->sync(if_p->members[i]);
+        if (SD_BLOCK_DEVICE_ERROR_NONE == rc) rc = member_rc;
+    }
+    return rc;
+}
+
+static uint32_t sd_striped_get_num_sectors(sd_card_t *sd_card_p) {
+    return sd_card_p->state.sectors;
+}
+
+static bool sd_striped_test_com(sd_card_t *sd_card_p) {
+    sd_striped_if_t *if_p = sd_card_p->striped_if_p;
+    bool ok = true;
+    for (size_t i = 0; i < if_p->num_members; ++i)
+        if (!if_p->members[i]->sd_test_com(if_p->members[i])) ok = false;
+    if (!ok) sd_card_p->state.m_Status |= STA_NOINIT;
+    return ok;
+}
+
+bool sd_striped_ctor(sd_card_t *sd_card_p) {
+    sd_striped_if_t *if_p = sd_card_p->striped_if_p;
+    myASSERT(if_p);  // Must have an interface object
+    myASSERT(if_p->members);
+    myASSERT(2 <= if_p->num_members && if_p->num_members <= SD_STRIPED_MAX_MEMBERS);
+    myASSERT(if_p->stripe_blocks);
+    myASSERT(!sd_card_p->use_card_detect);  // Members have their own card detect
+
+    bool ok = true;
+    for (size_t i = 0; i < if_p->num_members; ++i) {
+        sd_card_t *member_p = if_p->members[i];
+        myASSERT(member_p && member_p != sd_card_p);
+        if (!sd_card_ctor(member_p)) ok = false;
+    }
+    sd_card_p->state.m_Status = STA_NOINIT;
+    sd_card_p->state.sectors = 0;
+
+    sd_card_p->init = sd_striped_init;
+    sd_card_p->deinit = sd_striped_deinit;
+    sd_card_p->write_blocks = sd_striped_write_blocks;
+    sd_card_p->read_blocks = sd_striped_read_blocks;
+    sd_card_p->sync = sd_striped_sync;
+    sd_card_p->get_num_sectors = sd_striped_get_num_sectors;
+    sd_card_p->write_blocks_start = NULL;
+    sd_card_p->read_blocks_start = NULL;
+    sd_card_p->transfer_poll = NULL;
+    sd_card_p->sd_test_com = sd_striped_test_com;
+    return ok;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,45 @@
+/* sd_card_striped.h
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+/* Striped (RAID-0) virtual card.
+
+Presents two or more physical cards as one sd_card_t. The block address space
+is cut into stripes of stripe_blocks blocks, dealt out round-robin to the
+members, so a large transfer keeps every member busy at once. Each member
+contributes the same number of stripes, so the capacity is the number of
+members times the capacity of the smallest member (rounded down to a whole
+number of stripes).
+
+There is no redundancy: losing any member loses the volume.
+*/
+
+#pragma once
+
+#include "sd_card.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef SD_STRIPED_MAX_MEMBERS
+#  define SD_STRIPED_MAX_MEMBERS 4
+#endif
+
+bool sd_striped_ctor(sd_card_t *sd_card_p);  // Constructor for sd_card_t
+
+#ifdef __cplusplus
+}
+#endif
+
+/* [] END OF FILE */
@@ -4,26 +4,41 @@
 //
 #include "dma_interrupts.h"
 
-static void dma_irq_handler(const uint DMA_IRQ_num, io_rw_32 *dma_hw_ints_p) {
-    // Iterate through all of the SD cards
-    for (size_t i = 0; i < sd_get_num(); ++i) {
-        sd_card_t *sd_card_p = sd_get_by_num(i);
-        if (!sd_card_p)
-            continue;
-        uint irq_num = 0, channel = 0;
+static void card_dma_irq_handler(sd_card_t *sd_card_p, const uint DMA_IRQ_num,
+                                 io_rw_32 *dma_hw_ints_p) {
+    if (!sd_card_p)
+        return;
+    // Virtual cards: visit the members
+    if (SD_IF_STRIPED == sd_card_p->type) {
+        for (size_t i = 0; i < sd_card_p->striped_if_p->num_members; ++i)
+            card_dma_irq_handler(sd_card_p->striped_if_p->members[i], DMA_IRQ_num,
+                                 dma_hw_ints_p);
+        return;
+    }
+    if (SD_IF_MIRRORED == sd_card_p->type) {
+        for (size_t i = 0; i < count_of(sd_card_p->mirrored_if_p->members); ++i)
+            card_dma_irq_handler(sd_card_p->mirrored_if_p->members[i], DMA_IRQ_num,
+                                 dma_hw_ints_p);
+        return;
+    }
+    uint irq_num = 0, channel = 0;
+    if (SD_IF_SDIO == sd_card_p->type) {
+        irq_num = sd_card_p->sdio_if_p->DMA_IRQ_num;
+        channel = sd_card_p->sdio_if_p->state.SDIO_DMA_CHB;
+    }
+    // Is this channel requesting interrupt?
+    if (irq_num == DMA_IRQ_num && (*dma_hw_ints_p & (1 << channel))) {
+        *dma_hw_ints_p = 1 << channel;  // Clear it.
         if (SD_IF_SDIO == sd_card_p->type) {
-            irq_num = sd_card_p->sdio_if_p->DMA_IRQ_num;
-            channel = sd_card_p->sdio_if_p->state.SDIO_DMA_CHB;
-        }
-        // Is this channel requesting interrupt?
-        if (irq_num == DMA_IRQ_num && (*dma_hw_ints_p & (1 << channel))) {
-            *dma_hw_ints_p = 1 << channel;  // Clear it.
-            if (SD_IF_SDIO == sd_card_p->type) {
-                sdio_irq_handler(sd_card_p);
-            }
+            sdio_irq_handler(sd_card_p);
         }
     }
 }
+static void dma_irq_handler(const uint DMA_IRQ_num, io_rw_32 *dma_hw_ints_p) {
+    // Iterate through all of the SD cards
+    for (size_t i = 0; i < sd_get_num(); ++i)
+        card_dma_irq_handler(sd_get_by_num(i), DMA_IRQ_num, dma_hw_ints_p);
+}
 static void __not_in_flash_func(dma_irq_handler_0)() {
     dma_irq_handler(DMA_IRQ_0, &dma_hw->ints0);
 }
@@ -23,6 +23,8 @@ specific language governing permissions and limitations under the License.
 //
 #include "SDIO/SdioCard.h"
 #include "SPI/sd_card_spi.h"
+#include "Virtual/sd_card_mirrored.h"
+#include "Virtual/sd_card_striped.h"
 #include "hw_config.h"  // Hardware Configuration of the SPI and SD Card "objects"
 #include "my_debug.h"
 #include "sd_card_constants.h"
@@ -122,6 +124,75 @@ char const *sd_get_drive_prefix(sd_card_t *sd_card_p) {
     return sd_card_p->state.drive_prefix;
 }
 
+/* Set up one card "object". Virtual cards call this for their members. */
+bool sd_card_ctor(sd_card_t *sd_card_p) {
+    bool ok = true;
+
+    myASSERT(sd_card_p->type);
+
+    if (!mutex_is_initialized(&sd_card_p->state.mutex))
+        mutex_init(&sd_card_p->state.mutex);
+    sd_lock(sd_card_p);
+
+    sd_card_p->state.m_Status = STA_NOINIT;
+
+    // Set up Card Detect
+    if (sd_card_p->use_card_detect) {
+        if (sd_card_p->card_detect_use_pull) {
+            if (sd_card_p->card_detect_pull_hi) {
+                gpio_pull_up(sd_card_p->card_detect_gpio);
+            } else {
+                gpio_pull_down(sd_card_p->card_detect_gpio);
+            }
+        }
+        gpio_init(sd_card_p->card_detect_gpio);
+    }
+
+    switch (sd_card_p->type) {
+        case SD_IF_NONE:
+            myASSERT(false);
+            break;
+        case SD_IF_SPI:
+            myASSERT(sd_card_p->spi_if_p);  // Must have an interface object
+            myASSERT(sd_card_p->spi_if_p->spi);
+            sd_spi_ctor(sd_card_p);
+            if (!my_spi_init(sd_card_p->spi_if_p->spi)) {
+                ok = false;
+            }
+            /* At power up the SD card CD/DAT3 / CS  line has a 50KOhm pull up enabled
+             * in the card. This resistor serves two functions Card detection and Mode
+             * Selection. For Mode Selection, the host can drive the line high or let it
+             * be pulled high to select SD mode. If the host wants to select SPI mode it
+             * should drive the line low.
+             *
+             * There is an important thing needs to be considered that the MMC/SDC is
+             * initially NOT the SPI device. Some bus activity to access another SPI
+             * device can cause a bus conflict due to an accidental response of the
+             * MMC/SDC. Therefore the MMC/SDC should be initialized to put it into the
+             * SPI mode prior to access any other device attached to the same SPI bus.
+             */
+            sd_go_idle_state(sd_card_p);
+            break;
+        case SD_IF_SDIO:
+            myASSERT(sd_card_p->sdio_if_p);
+            sd_sdio_ctor(sd_card_p);
+            break;
+        case SD_IF_STRIPED:
+            myASSERT(sd_card_p->striped_if_p);
+            if (!sd_striped_ctor(sd_card_p)) ok = false;
+            break;
+        case SD_IF_MIRRORED:
+            myASSERT(sd_card_p->mirrored_if_p);
+            if (!sd_mirrored_ctor(sd_card_p)) ok = false;
+            break;
+        default:
+            myASSERT(false);
+    }  // switch (sd_card_p->type)
+
+    sd_unlock(sd_card_p);
+    return ok;
+}
+
 bool sd_init_driver() {
     auto_init_mutex(initialized_mutex);
     mutex_enter_blocking(&initialized_mutex);
@@ -131,63 +202,8 @@ bool sd_init_driver() {
         for (size_t i = 0; i < sd_get_num(); ++i) {
             sd_card_t *sd_card_p = sd_get_by_num(i);
             if (!sd_card_p) continue;
-
-            myASSERT(sd_card_p->type);
-
-            if (!mutex_is_initialized(&sd_card_p->state.mutex))
-                mutex_init(&sd_card_p->state.mutex);
-            sd_lock(sd_card_p);
-
-            sd_card_p->state.m_Status = STA_NOINIT;
-
             sd_set_drive_prefix(sd_card_p, i);
-
-            // Set up Card Detect
-            if (sd_card_p->use_card_detect) {
-                if (sd_card_p->card_detect_use_pull) {
-                    if (sd_card_p->card_detect_pull_hi) {
-                        gpio_pull_up(sd_card_p->card_detect_gpio);
-                    } else {
-                        gpio_pull_down(sd_card_p->card_detect_gpio);
-                    }
-                }
-                gpio_init(sd_card_p->card_detect_gpio);
-            }
-
-            switch (sd_card_p->type) {
-                case SD_IF_NONE:
-                    myASSERT(false);
-                    break;
-                case SD_IF_SPI:
-                    myASSERT(sd_card_p->spi_if_p);  // Must have an interface object
-                    myASSERT(sd_card_p->spi_if_p->spi);
-                    sd_spi_ctor(sd_card_p);
-                    if (!my_spi_init(sd_card_p->spi_if_p->spi)) {
-                        ok = false;
-                    }
-                    /* At power up the SD card CD/DAT3 / CS  line has a 50KOhm pull up enabled
-                     * in the card. This resistor serves two functions Card detection and Mode
-                     * Selection. For Mode Selection, the host can drive the line high or let it
-                     * be pulled high to select SD mode. If the host wants to select SPI mode it
-                     * should drive the line low.
-                     *
-                     * There is an important thing needs to be considered that the MMC/SDC is
-                     * initially NOT the SPI device. Some bus activity to access another SPI
-                     * device can cause a bus conflict due to an accidental response of the
-                     * MMC/SDC. Therefore the MMC/SDC should be initialized to put it into the
-                     * SPI mode prior to access any other device attached to the same SPI bus.
-                     */
-                    sd_go_idle_state(sd_card_p);
-                    break;
-                case SD_IF_SDIO:
-                    myASSERT(sd_card_p->sdio_if_p);
-                    sd_sdio_ctor(sd_card_p);
-                    break;
-                default:
-                    myASSERT(false);
-            }  // switch (sd_card_p->type)
-
-            sd_unlock(sd_card_p);
+            if (!sd_card_ctor(sd_card_p)) ok = false;
         }  // for
         driver_initialized = true;
     }
@@ -313,74 +329,121 @@ void csdDmp(sd_card_t *sd_card_p, printer_t printer) {
     };
 }
 
+static bool is_async(sd_xfer_t const *x_p) {
+    if (x_p->write) return x_p->sd_card_p->write_blocks_start;
+    return x_p->sd_card_p->read_blocks_start;
+}
+
+block_dev_err_t sd_transfer_concurrent(sd_xfer_t xfers[], size_t n) {
+    // Start the asynchronous ones
+    for (size_t i = 0; i < n; ++i) {
+        sd_xfer_t *x_p = &xfers[i];
+        sd_card_t *sd_card_p = x_p->sd_card_p;
+        for (size_t j = 0; j < i; ++j) myASSERT(xfers[j].sd_card_p != sd_card_p);
+        if (!is_async(x_p)) continue;
+        if (x_p->write)
+            x_p->status = sd_card_p->write_blocks_start(sd_card_p, x_p->buffer, x_p->sector, x_p->count);
+        else
+            x_p->status = sd_card_p->read_blocks_start(sd_card_p, x_p->buffer, x_p->sector, x_p->count);
+    }
+    // While those are running, do the synchronous ones
+    for (size_t i = 0; i < n; ++i) {
+        sd_xfer_t *x_p = &xfers[i];
+        sd_card_t *sd_card_p = x_p->sd_card_p;
+        if (is_async(x_p)) continue;
+        if (x_p->write)
+            x_p->status = sd_card_p->write_blocks(sd_card_p, x_p->buffer, x_p->sector, x_p->count);
+        else
+            x_p->status = sd_card_p->read_blocks(sd_card_p, x_p->buffer, x_p->sector, x_p->count);
+    }
+    // Wait on the asynchronous ones
+    block_dev_err_t rc = SD_BLOCK_DEVICE_ERROR_NONE;
+    for (size_t i = 0; i < n; ++i) {
+        sd_xfer_t *x_p = &xfers[i];
+        if (is_async(x_p) && SD_BLOCK_DEVICE_ERROR_NONE == x_p->status) {
+            do {
+                x_p->status = x_p->sd_card_p->transfer_poll(x_p->sd_card_p);
+            } while (SD_BLOCK_DEVICE_ERROR_WOULD_BLOCK == x_p->status);
+        }
+        if (SD_BLOCK_DEVICE_ERROR_NONE == rc) rc = x_p->status;
+    }
+    return rc;
+}
+
 #define KB 1024
 #define MB (1024 * 1024)
 
 /* AU (Allocation Unit):
 is a physical boundary of the card and consists of one or more blocks and its
-size depends on each card. */
+size depends on each card.
+The SDIO driver reads it from the SD Status when it initializes the card,
+while no multiple block write is open, so this sends no command. */
 bool sd_allocation_unit(sd_card_t *sd_card_p, size_t *au_size_bytes_p) {
-    if (SD_IF_SPI == sd_card_p->type) return false;  // SPI can't do full SD Status
+    if (SD_IF_SDIO != sd_card_p->type) return false;  // SPI can't do full SD Status
+    if (sd_card_p->state.m_Status & STA_NOINIT) return false;
+    *au_size_bytes_p = sd_card_p->state.au_size_bytes;
+    return true;
+}
 
-    uint8_t status[64] = {0};
-    bool ok = rp2040_sdio_get_sd_status(sd_card_p, status);
-    if (!ok) return false;
+// Size in bytes of the AU given by a 512 bit SD Status (0 if not defined)
+size_t sd_status_au_size(const uint8_t status[64]) {
+    size_t au_size_bytes = 0;
     // 431:428 AU_SIZE
     uint8_t au_size = ext_bits(64, status, 431, 428);
     switch (au_size) {
         // AU_SIZE Value Definition
         case 0x0:
-            *au_size_bytes_p = 0;
+            au_size_bytes = 0;
             break;  // Not Defined
         case 0x1:
-            *au_size_bytes_p = 16 * KB;
+            au_size_bytes = 16 * KB;
             break;
         case 0x2:
-            *au_size_bytes_p = 32 * KB;
+            au_size_bytes = 32 * KB;
             break;
         case 0x3:
-            *au_size_bytes_p = 64 * KB;
+            au_size_bytes = 64 * KB;
             break;
         case 0x4:
-            *au_size_bytes_p = 128 * KB;
+            au_size_bytes = 128 * KB;
             break;
         case 0x5:
-            *au_size_bytes_p = 256 * KB;
+            au_size_bytes = 256 * KB;
             break;
         case 0x6:
-            *au_size_bytes_p = 512 * KB;
+            au_size_bytes = 512 * KB;
             break;
         case 0x7:
-            *au_size_bytes_p = 1 * MB;
+            au_size_bytes = 1 * MB;
             break;
         case 0x8:
-            *au_size_bytes_p = 2 * MB;
+            au_size_bytes = 2 * MB;
             break;
         case 0x9:
-            *au_size_bytes_p = 4 * MB;
+            au_size_bytes = 4 * MB;
             break;
         case 0xA:
-            *au_size_bytes_p = 8 * MB;
+            au_size_bytes = 8 * MB;
             break;
         case 0xB:
-            *au_size_bytes_p = 12 * MB;
+            au_size_bytes = 12 * MB;
             break;
         case 0xC:
-            *au_size_bytes_p = 16 * MB;
+            au_size_bytes = 16 * MB;
             break;
         case 0xD:
-            *au_size_bytes_p = 24 * MB;
+            au_size_bytes = 24 * MB;
             break;
         case 0xE:
-            *au_size_bytes_p = 32 * MB;
+            au_size_bytes = 32 * MB;
             break;
         case 0xF:
-            *au_size_bytes_p = 64 * MB;
+            au_size_bytes = 64 * MB;
             break;
         default:
             myASSERT(false);
     }
-    return true;
+    return au_size_bytes;
 }
 
 /* [] END OF FILE */
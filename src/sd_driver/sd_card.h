@@ -24,6 +24,7 @@ specific language governing permissions and limitations under the License.
 #include <hardware/pio.h>
 
 #include "hardware/gpio.h"
+#include "pico/critical_section.h"
 #include "pico/mutex.h"
 //
 #include "ff.h"
@@ -40,7 +41,7 @@ specific language governing permissions and limitations under the License.
 extern "C" {
 #endif
 
-typedef enum { SD_IF_NONE, SD_IF_SPI, SD_IF_SDIO } sd_if_t;
+typedef enum { SD_IF_NONE, SD_IF_SPI, SD_IF_SDIO, SD_IF_STRIPED, SD_IF_MIRRORED } sd_if_t;
 
 typedef struct sd_spi_if_state_t {
     bool ongoing_mlt_blk_wrt;
@@ -98,6 +99,7 @@ typedef struct sd_card_state_t {
     CSD_t CSD;              // Card-Specific Data register.
     CID_t CID;              // Card IDentification register
     uint32_t sectors;       // Assigned dynamically
+    size_t au_size_bytes;   // Allocation Unit, read at init (0 if unknown)
 
     mutex_t mutex;
     FATFS fatfs;
@@ -111,12 +113,49 @@ typedef struct sd_card_state_t {
 
 typedef struct sd_card_t sd_card_t;
 
+/* Striped (RAID-0) virtual card built from two or more physical cards.
+Consecutive runs of stripe_blocks blocks go to the members in turn.
+The members are not themselves drives: don't list them in hw_config. */
+typedef struct sd_striped_if_t {
+    sd_card_t **members;
+    size_t num_members;      // 2 .. SD_STRIPED_MAX_MEMBERS
+    uint32_t stripe_blocks;  // Stripe size in 512 byte blocks
+} sd_striped_if_t;
+
+/* Mirrored (RAID-1) virtual card built from two physical cards.
+Writes go to both members; reads go to whichever member is less busy. */
+typedef struct sd_mirrored_if_state_t {
+    bool in_sync[2];            // Member holds a complete copy
+    bool resyncing[2];          // Member is being rebuilt from the other
+    uint32_t resync_lba;        // Blocks below this have been rebuilt
+    uint32_t generation;        // Of the members in sync (see sd_card_mirrored.c)
+    bool dirty;                 // The records are marked dirty
+    uint32_t dirty_ms;          // When the records were last written
+    volatile uint32_t busy[2];  // Transfers in progress on each member
+    size_t last_read;           // Member used for the last read
+    critical_section_t cs;      // Protects busy and last_read
+} sd_mirrored_if_state_t;
+
+typedef struct sd_mirrored_if_t {
+    sd_card_t *members[2];  // members[0] is the primary
+    /* On cards that have no mirror records yet, members[1] is rebuilt from
+    members[0]. Set this only if the application knows that both members
+    already hold the same contents. */
+    bool assume_in_sync;
+
+    /* The following fields are not part of the configuration.
+    They are state variables, and are dynamically assigned. */
+    sd_mirrored_if_state_t state;
+} sd_mirrored_if_t;
+
 // "Class" representing SD Cards
 struct sd_card_t {
     sd_if_t type;  // Interface type
     union {
         sd_spi_if_t *spi_if_p;
         sd_sdio_if_t *sdio_if_p;
+        sd_striped_if_t *striped_if_p;
+        sd_mirrored_if_t *mirrored_if_p;
     };
     bool use_card_detect;
     uint card_detect_gpio;    // Card detect; ignored if !use_card_detect
@@ -137,6 +176,17 @@ struct sd_card_t {
     block_dev_err_t (*sync)(sd_card_t *sd_card_p);
     uint32_t (*get_num_sectors)(sd_card_t *sd_card_p);
 
+    /* Optional asynchronous interface. NULL if the driver doesn't support it.
+    The *_start functions return once the transfer is under way
+    (or return an error). Then, call transfer_poll until it stops
+    returning SD_BLOCK_DEVICE_ERROR_WOULD_BLOCK. It returns the final status.
+    The card is locked from start until transfer_poll reports completion. */
+    block_dev_err_t (*write_blocks_start)(sd_card_t *sd_card_p, const uint8_t *buffer,
+                                          uint32_t ulSectorNumber, uint32_t blockCnt);
+    block_dev_err_t (*read_blocks_start)(sd_card_t *sd_card_p, uint8_t *buffer,
+                                         uint32_t ulSectorNumber, uint32_t ulSectorCount);
+    block_dev_err_t (*transfer_poll)(sd_card_t *sd_card_p);
+
     // Useful when use_card_detect is false - call periodically to check for presence of SD card
     // Returns true if and only if SD card was sensed on the bus
     bool (*sd_test_com)(sd_card_t *sd_card_p);
@@ -147,15 +197,34 @@ void sd_unlock(sd_card_t *sd_card_p);
 bool sd_is_locked(sd_card_t *sd_card_p);
 
 bool sd_init_driver();
+bool sd_card_ctor(sd_card_t *sd_card_p);
 bool sd_card_detect(sd_card_t *sd_card_p);
 void cidDmp(sd_card_t *sd_card_p, printer_t printer);
 void csdDmp(sd_card_t *sd_card_p, printer_t printer);
 bool sd_allocation_unit(sd_card_t *sd_card_p, size_t *au_size_bytes_p);
+size_t sd_status_au_size(const uint8_t status[64]);
 sd_card_t *sd_get_by_drive_prefix(const char *const name);
 
 // sd_init_driver() must be called before this:
 char const *sd_get_drive_prefix(sd_card_t *sd_card_p);
 
+/* One block transfer for sd_transfer_concurrent */
+typedef struct sd_xfer_t {
+    sd_card_t *sd_card_p;
+    bool write;  // else read
+    uint8_t *buffer;
+    uint32_t sector;
+    uint32_t count;
+    block_dev_err_t status;  // Result
+} sd_xfer_t;
+
+/* Run transfers to different cards concurrently from a single thread:
+start all of those whose driver supports asynchronous transfers,
+run the others synchronously meanwhile, then wait on all.
+Each transfer must be to a different card.
+Returns the first error, or SD_BLOCK_DEVICE_ERROR_NONE. */
+block_dev_err_t sd_transfer_concurrent(sd_xfer_t xfers[], size_t n);
+
 #ifdef __cplusplus
 }
 #endif
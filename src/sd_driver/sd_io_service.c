@@ -0,0 +1,153 @@
+/* sd_io_service.c
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+//
+#include "hardware/sync.h"
+#include "pico/critical_section.h"
+#include "pico/multicore.h"
+#include "pico/stdlib.h"
+//
+#include "my_debug.h"
+#include "sd_card.h"
+//
+#include "sd_io_service.h"
+
+#define TRACE_PRINTF(fmt, args...)
+// #define TRACE_PRINTF printf
+
+static_assert(!(SD_IO_QUEUE_DEPTH & (SD_IO_QUEUE_DEPTH - 1)),
+              "SD_IO_QUEUE_DEPTH must be a power of 2");
+#define QUEUE_MASK (SD_IO_QUEUE_DEPTH - 1)
+
+/* Multiple producer, single consumer ring.
+`head` is only written by producers, which take `submit_cs` to claim a slot
+and publish it, and `tail` only by the consumer, which takes no lock.
+Both are free running; the difference is the fill level. */
+static sd_io_req_t *volatile ring[SD_IO_QUEUE_DEPTH];
+static volatile uint32_t head;
+static volatile uint32_t tail;
+static critical_section_t submit_cs;
+
+static volatile int service_core = -1;
+
+bool sd_io_service_running(void) {
+    return service_core >= 0;
+}
+
+bool sd_io_service_offload(void) {
+    return service_core >= 0 && (int)get_core_num() != service_core;
+}
+
+bool sd_io_submit(sd_io_req_t *req_p) {
+    myASSERT(sd_io_service_running());
+    req_p->done = false;
+    // Other tasks or the other core may be submitting too
+    critical_section_enter_blocking(&submit_cs);
+    uint32_t h = head;
+    if (h - tail >= SD_IO_QUEUE_DEPTH) {  // Full
+        critical_section_exit(&submit_cs);
+        return false;
+    }
+    ring[h & QUEUE_MASK] = req_p;
+    __mem_fence_release();  // Publish the request before the new head
+    head = h + 1;
+    critical_section_exit(&submit_cs);
+    __sev();  // Wake the service
+    return true;
+}
+
+block_dev_err_t sd_io_wait(sd_io_req_t *req_p) {
+    while (!req_p->done) __wfe();
+    __mem_fence_acquire();
+    return req_p->status;
+}
+
+block_dev_err_t sd_io_transfer(sd_card_t *sd_card_p, sd_io_op_t op, uint8_t *buffer,
+                               uint32_t sector, uint32_t count) {
+    sd_io_req_t req = {
+        .sd_card_p = sd_card_p, .op = op, .buffer = buffer, .sector = sector, .count = count};
+    while (!sd_io_submit(&req)) __wfe();  // Wait for space in the ring
+    return sd_io_wait(&req);
+}
+
+/* Can `next_p` be appended to a transfer that starts with `first_p`
+and is already `blocks` long? */
+static bool mergeable(sd_io_req_t const *first_p, uint32_t blocks, sd_io_req_t const *next_p) {
+    if (SD_IO_READ != first_p->op && SD_IO_WRITE != first_p->op) return false;
+    return next_p->sd_card_p == first_p->sd_card_p && next_p->op == first_p->op &&
+           next_p->sector == first_p->sector + blocks &&
+           next_p->buffer == first_p->buffer + blocks * sd_block_size &&
+           blocks + next_p->count <= SD_IO_MAX_MERGE_BLOCKS;
+}
+
+static block_dev_err_t execute(sd_io_req_t const *req_p, uint32_t blocks) {
+    sd_card_t *sd_card_p = req_p->sd_card_p;
+    TRACE_PRINTF("%s: op=%d sector=%lu blocks=%lu\n", __func__, req_p->op, req_p->sector, blocks);
+    switch (req_p->op) {
+        case SD_IO_READ:
+            return sd_card_p->read_blocks(sd_card_p, req_p->buffer, req_p->sector, blocks);
+        case SD_IO_WRITE:
+            return sd_card_p->write_blocks(sd_card_p, req_p->buffer, req_p->sector, blocks);
+        case SD_IO_SYNC:
+            return sd_card_p->sync(sd_card_p);
+        case SD_IO_INIT:
+            /* The SDIO driver registers its DMA IRQ handler on the core that
+            initializes it, so initialization must happen here too. */
+            sd_card_p->init(sd_card_p);
+            return SD_BLOCK_DEVICE_ERROR_NONE;
+        default:
+            myASSERT(false);
+            return SD_BLOCK_DEVICE_ERROR_PARAMETER;
+    }
+}
+
+void sd_io_service_run(void) {
+    if (!critical_section_is_initialized(&submit_cs)) critical_section_init(&submit_cs);
+    service_core = get_core_num();  // Submitters may start from here on
+    for (;;) {
+        uint32_t t = tail;
+        uint32_t h;
+        while (t == (h = head)) __wfe();
+        __mem_fence_acquire();  // See the request contents published with head
+
+        sd_io_req_t *req_p = ring[t & QUEUE_MASK];
+        uint32_t n = 1;
+        uint32_t blocks = req_p->count;
+        while (t + n != h && mergeable(req_p, blocks, ring[(t + n) & QUEUE_MASK])) {
+            blocks += ring[(t + n) & QUEUE_MASK]->count;
+            ++n;
+        }
+        block_dev_err_t rc = execute(req_p, blocks);
+
+        for (uint32_t i = 0; i < n; ++i) {
+            sd_io_req_t *done_p = ring[(t + i) & QUEUE_MASK];
+            done_p->status = rc;
+            if (done_p->callback) done_p->callback(done_p);
+            __mem_fence_release();
+            done_p->done = true;  // The submitter may reuse *done_p from here on
+        }
+        tail = t + n;
+        __sev();  // Wake any waiters
+    }
+}
+
+void sd_io_service_start(void) {
+    if (sd_io_service_running()) return;
+    multicore_launch_core1(sd_io_service_run);
+    while (!sd_io_service_running()) tight_loop_contents();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,109 @@
+/* sd_io_service.h
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+/* Optional I/O service that owns the SD card drivers on one core
+(normally core 1).
+
+Other code (normally on core 0) submits block requests through a ring and
+learns of their completion from the request's `done` flag or its callback.
+The ring is not lock-free: submitters serialize on a critical section (a spin
+lock, with interrupts off) that is held for a few instructions, so that any
+number of tasks, on either core, can submit. The service reads the ring
+without taking it. The service merges adjacent queued requests that are
+contiguous on the card and in memory into one multi-block transfer. Requests
+are otherwise executed in submission order, because FatFs relies on write
+ordering for consistency.
+
+While the service is running, disk_initialize, disk_read, disk_write and
+disk_ioctl(CTRL_SYNC) called from any other core are forwarded to it. This
+moves the card I/O to the service's core, but FatFs is synchronous, so the
+calling core still waits (in __wfe) until each request is done. Only code
+that uses sd_io_submit directly, and polls sd_io_is_done or takes the
+callback, can overlap its own work with the transfer.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+//
+#include "sd_card.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of requests that can be queued. Must be a power of 2. */
+#ifndef SD_IO_QUEUE_DEPTH
+#  define SD_IO_QUEUE_DEPTH 16
+#endif
+
+/* Upper limit on the number of blocks in a merged transfer */
+#ifndef SD_IO_MAX_MERGE_BLOCKS
+#  define SD_IO_MAX_MERGE_BLOCKS 256
+#endif
+
+typedef enum { SD_IO_READ, SD_IO_WRITE, SD_IO_SYNC, SD_IO_INIT } sd_io_op_t;
+
+typedef struct sd_io_req_t {
+    sd_card_t *sd_card_p;
+    sd_io_op_t op;
+    uint8_t *buffer;  // Not used for SD_IO_SYNC or SD_IO_INIT
+    uint32_t sector;
+    uint32_t count;  // Number of blocks
+    /* If not NULL, called on the service's core when the request is complete
+    (`status` is set), just before `done` is set. It must be short and must
+    not submit and wait. */
+    void (*callback)(struct sd_io_req_t *req_p);
+    void *context;  // For the callback's use
+
+    /* The following fields are written by the service.
+    The request must stay valid (and unmodified) until `done` is true. */
+    volatile bool done;
+    volatile block_dev_err_t status;
+} sd_io_req_t;
+
+/* Launch the service on core 1 with multicore_launch_core1. */
+void sd_io_service_start(void);
+
+/* Body of the service. Never returns.
+Call this from your own core 1 entry point instead of sd_io_service_start
+if the application needs to manage core 1 itself. */
+void sd_io_service_run(void);
+
+bool sd_io_service_running(void);
+
+/* True if and only if block I/O issued from the calling core
+should be forwarded to the service */
+bool sd_io_service_offload(void);
+
+/* Queue a request. Never blocks.
+Returns false if the queue is full.
+Safe to call from any number of tasks or cores at once. */
+bool sd_io_submit(sd_io_req_t *req_p);
+
+static inline bool sd_io_is_done(const sd_io_req_t *req_p) { return req_p->done; }
+
+/* Wait (with WFE) for a submitted request to complete */
+block_dev_err_t sd_io_wait(sd_io_req_t *req_p);
+
+/* Submit and wait. The calling core is blocked for the whole transfer. */
+block_dev_err_t sd_io_transfer(sd_card_t *sd_card_p, sd_io_op_t op, uint8_t *buffer,
+                               uint32_t sector, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* [] END OF FILE */
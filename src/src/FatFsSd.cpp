@@ -15,9 +15,12 @@ specific language governing permissions and limitations under the License.
 #include "FatFsSd.h"
 
 #include <assert.h>
+#include <ctype.h>
 #include <stdarg.h>
 #include <stdio.h>
 
+#include "fmt_number.h"
+
 using namespace FatFsNs;
 
 /*
@@ -27,10 +30,96 @@ using namespace FatFsNs;
 
 std::vector<SdCard> FatFs::SdCards;
 
+/* True if f_printf formats every conversion in format the way vsnprintf does.
+It lacks, e.g., %i, %g, %p, %zu and the '+', ' ' and '#' flags, and it puts
+'0' padding before the sign and ignores the precision of integers. Its %e
+differs in the exponent, and its %f matches only for values that fmt_fixed
+converts (ftoa prints "NaN", "+INF" or "+OV" for the rest), so the arguments
+are checked too. Consumes ap. */
+static bool f_printf_compatible(const TCHAR* format, va_list ap) {
+    for (const TCHAR* p = format; *p; ++p) {
+        if ('%' != *p) continue;
+        if ('%' == *++p) continue;
+        bool zero = '0' == *p;
+        if (zero || '-' == *p) ++p;
+        bool width = '*' == *p || isdigit(*p);
+        if ('*' == *p) {
+            (void)va_arg(ap, int);
+            ++p;
+        } else {
+            while (isdigit(*p)) ++p;
+        }
+        bool prec = '.' == *p;
+        int prec_v = -1;
+        if (prec) {
+            if ('*' == *++p) {
+                prec_v = va_arg(ap, int);
+                ++p;
+            } else {
+                for (prec_v = 0; isdigit(*p); ++p) prec_v = prec_v * 10 + *p - '0';
+            }
+        }
+        bool size = 'l' == *p;
+        bool llong = size && 'l' == *++p;
+        if (llong) {
+#if FF_PRINT_LLI && FF_INTDEF == 2
+            ++p;
+#else
+            return false;
+#endif
+        }
+        switch (*p) {
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+            case 'd':
+                if (prec || ('d' == *p && zero)) return false;
+                if (llong)
+                    (void)va_arg(ap, long long);
+                else if (size)
+                    (void)va_arg(ap, long);
+                else
+                    (void)va_arg(ap, int);
+                break;
+            case 'c':
+                if (width || size) return false;
+                (void)va_arg(ap, int);
+                break;
+            case 's':
+                if (size) return false;
+                (void)va_arg(ap, const char*);
+                break;
+#if FF_PRINT_FLOAT == 1 && FF_INTDEF == 2
+            case 'f': {
+                if (zero) return false;
+                char str[32];  // SZ_NUM_BUF in ff.c
+                if (!fmt_fixed(str, str + sizeof str - 1, va_arg(ap, double),
+                               prec_v < 0 ? 6 : prec_v))
+                    return false;
+                break;
+            }
+#endif
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
 /* Put a formatted string to the file */
 int File::printf(const TCHAR* format, ...) {
-    va_list arg;
+    va_list arg, ap;
     va_start(arg, format);
+    va_copy(ap, arg);
+    bool compatible = f_printf_compatible(format, ap);
+    va_end(ap);
+    if (compatible) {
+        // Formats in a single pass straight into the file's sector buffer
+        int rc = f_vprintf(&fil, format, arg);
+        va_end(arg);
+        return rc;
+    }
     char temp[64];
     char* buffer = temp;
     size_t len = vsnprintf(temp, sizeof(temp), format, arg);
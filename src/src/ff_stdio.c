@@ -87,6 +87,66 @@ int fresult2errno(FRESULT fr) {
     }
 }
 
+#if FF_STDIO_BUF_SIZE
+/* The FF_FILE buffer holds either bytes read ahead of the stream position
+(pos to len, with the FIL at len) or bytes written at it (0 to pos, with
+the FIL at 0). A refill or a run of writes is limited to the rest of the
+buffer-sized block of the file, so that the transfers are whole blocks
+once they are aligned. Calls that work on the FIL directly first give
+the buffer back with sync_buf. */
+#  define FIL_OF(s) (&(s)->fil)
+
+static void init_buf(FF_FILE *pxStream) {
+    pxStream->wr = 0;
+    pxStream->pos = pxStream->len = 0;
+}
+// Write out the pending bytes, or move the FIL back over the read ahead
+// bytes, and empty the buffer
+static FRESULT sync_buf(FF_FILE *pxStream) {
+    FRESULT fr = FR_OK;
+    if (pxStream->wr) {
+        if (pxStream->pos) {
+            UINT bw = 0;
+            fr = f_write(&pxStream->fil, pxStream->buf, pxStream->pos, &bw);
+            if (FR_OK == fr && bw < pxStream->pos) fr = FR_DENIED;  // Disk full
+        }
+    } else if (pxStream->pos < pxStream->len) {
+        fr = f_lseek(&pxStream->fil, f_tell(&pxStream->fil) - (pxStream->len - pxStream->pos));
+    }
+    init_buf(pxStream);
+    return fr;
+}
+// Read ahead up to the end of the block
+static FRESULT fill_buf(FF_FILE *pxStream) {
+    FRESULT fr = sync_buf(pxStream);
+    if (FR_OK != fr) return fr;
+    UINT br = 0;
+    fr = f_read(&pxStream->fil, pxStream->buf,
+                FF_STDIO_BUF_SIZE - f_tell(&pxStream->fil) % FF_STDIO_BUF_SIZE, &br);
+    pxStream->len = br;
+    return fr;
+}
+// Make room for writing, up to the end of the block
+static FRESULT start_write(FF_FILE *pxStream) {
+    if (!(pxStream->fil.flag & FA_WRITE)) return FR_DENIED;  // As f_write would
+    FRESULT fr = sync_buf(pxStream);
+    if (FR_OK != fr) return fr;
+    pxStream->wr = 1;
+    pxStream->len = FF_STDIO_BUF_SIZE - f_tell(&pxStream->fil) % FF_STDIO_BUF_SIZE;
+    return fr;
+}
+// Stream position
+static FSIZE_t buf_tell(FF_FILE *pxStream) {
+    if (pxStream->wr) return f_tell(&pxStream->fil) + pxStream->pos;
+    return f_tell(&pxStream->fil) - (pxStream->len - pxStream->pos);
+}
+#else
+#  define FIL_OF(s) (s)
+#  define init_buf(s)
+#  define sync_buf(s) FR_OK
+#  define buf_tell(s) f_tell(s)
+#endif
+
 FF_FILE *ff_fopen(const char *pcFile, const char *pcMode) {
     TRACE_PRINTF("%s\n", __func__);
     // FRESULT f_open (FIL* fp, const TCHAR* path, BYTE mode);
@@ -95,12 +155,13 @@ FF_FILE *ff_fopen(const char *pcFile, const char *pcMode) {
     //  const TCHAR* path, /* [IN] File name */
     //  BYTE mode          /* [IN] Mode flags */
     //);
-    FIL *fp = malloc(sizeof(FIL));
+    FF_FILE *fp = malloc(sizeof(FF_FILE));
     if (!fp) {
         errno = ENOMEM;
         return NULL;
     }
-    FRESULT fr = f_open(fp, pcFile, posix2mode(pcMode));
+    init_buf(fp);
+    FRESULT fr = f_open(FIL_OF(fp), pcFile, posix2mode(pcMode));
     errno = fresult2errno(fr);
     if (FR_OK != fr) {
         TRACE_PRINTF("%s error: %s (%d)\n", __func__, FRESULT_str(fr), fr);
@@ -114,7 +175,9 @@ int ff_fclose(FF_FILE *pxStream) {
     // FRESULT f_close (
     //  FIL* fp     /* [IN] Pointer to the file object */
     //);
-    FRESULT fr = f_close(pxStream);
+    FRESULT fr = pxStream ? sync_buf(pxStream) : FR_OK;  // f_close checks the object
+    FRESULT fr2 = f_close(FIL_OF(pxStream));
+    if (FR_OK == fr) fr = fr2;
     if (FR_OK != fr)
         TRACE_PRINTF("%s error: %s (%d)\n", __func__, FRESULT_str(fr), fr);
     errno = fresult2errno(fr);
@@ -154,7 +217,29 @@ size_t ff_fwrite(const void *pvBuffer, size_t xSize, size_t xItems,
     //  bytes written */
     //);
     UINT bw = 0;
+#if FF_STDIO_BUF_SIZE
+    FRESULT fr = FR_OK;
+    size_t n = xSize * xItems;
+    if (n < FF_STDIO_BUF_SIZE) {
+        // Add a small write to the pending bytes, writing out each block as it fills
+        while (bw < n) {
+            if (!pxStream->wr || pxStream->pos == pxStream->len) {
+                fr = start_write(pxStream);
+                if (FR_OK != fr) break;
+            }
+            UINT k = pxStream->len - pxStream->pos;
+            if (k > n - bw) k = n - bw;
+            memcpy(pxStream->buf + pxStream->pos, (const BYTE *)pvBuffer + bw, k);
+            pxStream->pos += k;
+            bw += k;
+        }
+    } else {
+        fr = sync_buf(pxStream);
+        if (FR_OK == fr) fr = f_write(FIL_OF(pxStream), pvBuffer, n, &bw);
+    }
+#else
     FRESULT fr = f_write(pxStream, pvBuffer, xSize * xItems, &bw);
+#endif
     if (FR_OK != fr)
         TRACE_PRINTF("%s error: %s (%d)\n", __func__, FRESULT_str(fr), fr);
     errno = fresult2errno(fr);
@@ -170,7 +255,38 @@ size_t ff_fread(void *pvBuffer, size_t xSize, size_t xItems,
     //  UINT* br     /* [OUT] Number of bytes read */
     //);
     UINT br = 0;
+#if FF_STDIO_BUF_SIZE
+    FRESULT fr = FR_OK;
+    size_t n = xSize * xItems;
+    if (n < FF_STDIO_BUF_SIZE) {
+        // Serve a small read from the bytes read ahead, reading ahead a block at a time
+        while (br < n) {
+            if (pxStream->wr || pxStream->pos == pxStream->len) {
+                fr = fill_buf(pxStream);
+                if (FR_OK != fr || !pxStream->len) break;  // Error or EOF
+            }
+            UINT k = pxStream->len - pxStream->pos;
+            if (k > n - br) k = n - br;
+            memcpy((BYTE *)pvBuffer + br, pxStream->buf + pxStream->pos, k);
+            pxStream->pos += k;
+            br += k;
+        }
+    } else {
+        // Take what there is from the bytes read ahead
+        if (!pxStream->wr && pxStream->pos < pxStream->len) {
+            br = pxStream->len - pxStream->pos;
+            memcpy(pvBuffer, pxStream->buf + pxStream->pos, br);
+            pxStream->pos += br;
+        }
+        // and read the rest directly
+        UINT br2 = 0;
+        fr = sync_buf(pxStream);
+        if (FR_OK == fr) fr = f_read(FIL_OF(pxStream), (BYTE *)pvBuffer + br, n - br, &br2);
+        br += br2;
+    }
+#else
     FRESULT fr = f_read(pxStream, pvBuffer, xSize * xItems, &br);
+#endif
     if (FR_OK != fr)
         TRACE_PRINTF("%s error: %s (%d)\n", __func__, FRESULT_str(fr), fr);
     errno = fresult2errno(fr);
@@ -246,10 +362,23 @@ int ff_fputc(int iChar, FF_FILE *pxStream) {
     //  UINT* bw          /* [OUT] Pointer to the variable to return number of
     //  bytes written */
     //);
+#if FF_STDIO_BUF_SIZE
+    if (pxStream->wr && pxStream->pos < pxStream->len) {
+        pxStream->buf[pxStream->pos++] = iChar;
+        return iChar;
+    }
+    FRESULT fr = start_write(pxStream);
+    UINT bw = 0;
+    if (FR_OK == fr) {
+        pxStream->buf[pxStream->pos++] = iChar;
+        bw = 1;
+    }
+#else
     UINT bw = 0;
     uint8_t buff[1];
     buff[0] = iChar;
     FRESULT fr = f_write(pxStream, buff, 1, &bw);
+#endif
     if (FR_OK != fr)
         TRACE_PRINTF("%s error: %s (%d)\n", __func__, FRESULT_str(fr), fr);
     errno = fresult2errno(fr);
@@ -270,9 +399,21 @@ int ff_fgetc(FF_FILE *pxStream) {
     //  UINT btr,    /* [IN] Number of bytes to read */
     //  UINT* br     /* [OUT] Number of bytes read */
     //);
+#if FF_STDIO_BUF_SIZE
+    if (!pxStream->wr && pxStream->pos < pxStream->len)
+        return pxStream->buf[pxStream->pos++];
+    FRESULT fr = fill_buf(pxStream);
+    UINT br = 0;
+    uint8_t buff[1] = {0};
+    if (FR_OK == fr && pxStream->pos < pxStream->len) {
+        buff[0] = pxStream->buf[pxStream->pos++];
+        br = 1;
+    }
+#else
     uint8_t buff[1] = {0};
     UINT br;
     FRESULT fr = f_read(pxStream, buff, 1, &br);
+#endif
     if (FR_OK != fr)
         TRACE_PRINTF("%s error: %s (%d)\n", __func__, FRESULT_str(fr), fr);
     errno = fresult2errno(fr);
@@ -313,25 +454,31 @@ long ff_ftell(FF_FILE *pxStream) {
     // FSIZE_t f_tell (
     //  FIL* fp   /* [IN] File object */
     //);
-    FSIZE_t pos = f_tell(pxStream);
+    FSIZE_t pos = buf_tell(pxStream);
     myASSERT(pos < LONG_MAX);
     return pos;
 }
 int ff_fseek(FF_FILE *pxStream, int iOffset, int iWhence) {
     TRACE_PRINTF("%s\n", __func__);
-    FRESULT fr = -1;
+    FRESULT fr = sync_buf(pxStream);
+    if (FR_OK != fr) {
+        errno = fresult2errno(fr);
+        return -1;
+    }
+    FIL *fp = FIL_OF(pxStream);
+    fr = -1;
     switch (iWhence) {
         case FF_SEEK_CUR:  // The current file position.
-            if ((int)f_tell(pxStream) + iOffset < 0) return -1;
-            fr = f_lseek(pxStream, f_tell(pxStream) + iOffset);
+            if ((int)f_tell(fp) + iOffset < 0) return -1;
+            fr = f_lseek(fp, f_tell(fp) + iOffset);
             break;
         case FF_SEEK_END:  // The end of the file.
-            if ((int)f_size(pxStream) + iOffset < 0) return -1;
-            fr = f_lseek(pxStream, f_size(pxStream) + iOffset);
+            if ((int)f_size(fp) + iOffset < 0) return -1;
+            fr = f_lseek(fp, f_size(fp) + iOffset);
             break;
         case FF_SEEK_SET:  // The beginning of the file.
             if (iOffset < 0) return -1;
-            fr = f_lseek(pxStream, iOffset);
+            fr = f_lseek(fp, iOffset);
             break;
         default:
             myASSERT(!"Bad iWhence");
@@ -398,11 +545,13 @@ int ff_findnext(FF_FindData_t *pxFindData) {
 }
 FF_FILE *ff_truncate(const char *pcFileName, long lTruncateSize) {
     TRACE_PRINTF("%s\n", __func__);
-    FIL *fp = malloc(sizeof(FIL));
-    if (!fp) {
+    FF_FILE *pxStream = malloc(sizeof(FF_FILE));
+    if (!pxStream) {
         errno = ENOMEM;
         return NULL;
     }
+    init_buf(pxStream);
+    FIL *fp = FIL_OF(pxStream);
     FRESULT fr = f_open(fp, pcFileName, FA_OPEN_APPEND | FA_WRITE);
     if (FR_OK != fr)
         EMSG_PRINTF("%s: f_open error: %s (%d)\n", __func__, FRESULT_str(fr), fr);
@@ -428,13 +577,14 @@ FF_FILE *ff_truncate(const char *pcFileName, long lTruncateSize) {
                fr);
     errno = fresult2errno(fr);
     if (FR_OK == fr)
-        return fp;
+        return pxStream;
     else
         return NULL;
 }
 int ff_seteof(FF_FILE *pxStream) {
     TRACE_PRINTF("%s\n", __func__);
-    FRESULT fr = f_truncate(pxStream);
+    FRESULT fr = sync_buf(pxStream);
+    if (FR_OK == fr) fr = f_truncate(FIL_OF(pxStream));
     errno = fresult2errno(fr);
     if (FR_OK == fr)
         return 0;
@@ -460,7 +610,37 @@ int ff_rename(const char *pcOldName, const char *pcNewName,
 }
 char *ff_fgets(char *pcBuffer, size_t xCount, FF_FILE *pxStream) {
     TRACE_PRINTF("%s\n", __func__);
+#if FF_STDIO_BUF_SIZE
+    // Copy bytes up to and including a newline, like fgets
+    if (!xCount) {
+        errno = EINVAL;
+        return NULL;
+    }
+    size_t n = 0;
+    while (n < xCount - 1) {
+        if (pxStream->wr || pxStream->pos == pxStream->len) {
+            FRESULT fr = fill_buf(pxStream);
+            if (FR_OK != fr) {
+                errno = fresult2errno(fr);
+                return NULL;
+            }
+            if (!pxStream->len) break;  // EOF
+        }
+        size_t k = pxStream->len - pxStream->pos;
+        if (k > xCount - 1 - n) k = xCount - 1 - n;
+        const BYTE *src = pxStream->buf + pxStream->pos;
+        const BYTE *nl = memchr(src, '\n', k);
+        if (nl) k = nl - src + 1;
+        memcpy(pcBuffer + n, src, k);
+        pxStream->pos += k;
+        n += k;
+        if (nl) break;
+    }
+    pcBuffer[n] = 0;
+    TCHAR *p = n ? pcBuffer : NULL;  // As f_gets, even when xCount is 1
+#else
     TCHAR *p = f_gets(pcBuffer, xCount, pxStream);
+#endif
     // On success a pointer to pcBuffer is returned. If there is a read error
     // then NULL is returned and the task's errno is set to indicate the reason.
     if (p == pcBuffer)
@@ -470,3 +650,16 @@ char *ff_fgets(char *pcBuffer, size_t xCount, FF_FILE *pxStream) {
         return NULL;
     }
 }
+#if FF_STDIO_BUF_SIZE
+int ff_rewind(FF_FILE *pxStream) {
+    return ff_fseek(pxStream, 0, FF_SEEK_SET);
+}
+FSIZE_t ff_filelength(FF_FILE *pxStream) {
+    // Pending bytes can extend the file
+    FSIZE_t end = buf_tell(pxStream);
+    return end > f_size(&pxStream->fil) ? end : f_size(&pxStream->fil);
+}
+int ff_feof(FF_FILE *pxStream) {
+    return buf_tell(pxStream) >= ff_filelength(pxStream);
+}
+#endif
@@ -6,6 +6,8 @@
  */
 
 #define _GNU_SOURCE
+#include <assert.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -21,13 +23,55 @@
 
 typedef struct {
     FIL file;
+    char *buf;       // stdio buffer, or NULL for the C library's default
+    size_t buf_size;
 } cookie_t;
 
+// Take cookies and buffers from the FatFs block pool when it is enabled
+// (see FF_MEMPOOL_BLOCKS in ffconf.h)
+#if FF_MEMPOOL_BLOCKS
+// A block of the default size (0) holds a FIL and two words (see ffsystem.c)
+static_assert(FF_MEMPOOL_BLOCK_SIZE ? FF_MEMPOOL_BLOCK_SIZE >= sizeof(cookie_t)
+                                    : sizeof(cookie_t) <= sizeof(FIL) + 2 * sizeof(void *),
+              "A FatFs pool block must hold a cookie_t");
+#  define cookie_alloc() ff_memalloc(sizeof(cookie_t))
+#  define cookie_free(p) ff_memfree(p)
+#  define buf_alloc(n) ff_memalloc(n)
+#  define buf_free(p) ff_memfree(p)
+#else
+#  define cookie_alloc() malloc(sizeof(cookie_t))
+#  define cookie_free(p) free(p)
+#  define buf_alloc(n) malloc(n)
+#  define buf_free(p) free(p)
+#endif
+
+#if FF_MAX_SS == FF_MIN_SS
+#  define SECTOR_SIZE(fs) ((UINT)FF_MAX_SS)
+#else
+#  define SECTOR_SIZE(fs) ((fs)->ssize)
+#endif
+
+// Bytes from the file pointer to the next sector boundary (0 if it is on one)
+static size_t to_sector_boundary(FIL *file_p) {
+    UINT ss = SECTOR_SIZE(file_p->obj.fs);
+    return (ss - (UINT)(f_tell(file_p) % ss)) % ss;
+}
+
+// Is p in the stream's own buffer?
+static bool in_buf(cookie_t *cookie_p, const char *p) {
+    return cookie_p->buf && p >= cookie_p->buf && p < cookie_p->buf + cookie_p->buf_size;
+}
+
 // functions.read should return -1 on failure, or else the number of bytes read (0 on EOF).
 //  It is similar to read, except that cookie will be passed as the first argument.
 static ssize_t cookie_read_function(void *vcookie_p, char *buf, size_t n) {
     cookie_t *cookie_p = vcookie_p;
     FIL *file_p = &cookie_p->file;
+    /* A refill of the stream buffer from the middle of a sector (after a seek)
+    stops at the sector boundary, so that the following refills are whole,
+    aligned sectors that f_read can transfer straight into the buffer. */
+    size_t head = to_sector_boundary(file_p);
+    if (head && n > head && in_buf(cookie_p, buf)) n = head;
     UINT br;
     FRESULT fr = f_read(file_p, buf, n, &br);
     if (FR_OK != fr) {
@@ -43,9 +87,32 @@ static ssize_t cookie_write_function(void *vcookie_p, const char *buf, size_t n)
     cookie_t *cookie_p = vcookie_p;
     FIL *file_p = &cookie_p->file;
     UINT bw;
-    FRESULT fr = f_write(file_p, buf, n, &bw);
+    FRESULT fr;
+    /* SDIO can only DMA whole sectors out of word aligned memory; otherwise
+    it copies and writes them one at a time. When a flush of the stream
+    buffer from the middle of a sector (after a seek, an append or an
+    fflush) would leave its whole sectors at an unaligned address, the
+    sector in progress is completed first, and the rest is moved down to the
+    start of the stream buffer, a chunk at a time, and written from there.
+    This also leaves later flushes sector aligned. A caller's data that the
+    C library passes straight through is written as it is. */
+    size_t head = to_sector_boundary(file_p);
+    if (in_buf(cookie_p, buf) && n >= head + SECTOR_SIZE(file_p->obj.fs) &&
+        ((uintptr_t)(buf + head) & 3)) {
+        fr = f_write(file_p, buf, head, &bw);
+        size_t done = bw, chunk = head;
+        while (FR_OK == fr && bw == chunk && done < n) {
+            chunk = n - done < cookie_p->buf_size ? n - done : cookie_p->buf_size;
+            memmove(cookie_p->buf, buf + done, chunk);
+            fr = f_write(file_p, cookie_p->buf, chunk, &bw);
+            done += bw;
+        }
+        bw = done;
+    } else {
+        fr = f_write(file_p, buf, n, &bw);
+    }
     if (FR_OK != fr) {
-        DBG_PRINTF("f_read error: %s\n", FRESULT_str(fr));
+        DBG_PRINTF("f_write error: %s\n", FRESULT_str(fr));
         return -1;
     }
     return bw;
@@ -89,7 +156,8 @@ static int cookie_close_function(void *vcookie_p) {
     cookie_t *cookie_p = vcookie_p;
     FIL *file_p = &cookie_p->file;
     FRESULT fr = f_close(file_p);
-    free(vcookie_p);
+    buf_free(cookie_p->buf);
+    cookie_free(vcookie_p);
     if (FR_OK != fr) {
         DBG_PRINTF("f_close error: %s\n", FRESULT_str(fr));
         return -1;
@@ -99,7 +167,7 @@ static int cookie_close_function(void *vcookie_p) {
 }
 
 FILE *open_file_stream(const char *pathname, const char *pcMode) {
-    cookie_t *cookie_p = malloc(sizeof(cookie_t));
+    cookie_t *cookie_p = cookie_alloc();
     if (!cookie_p) {
         return NULL;
     }
@@ -127,14 +195,38 @@ FILE *open_file_stream(const char *pathname, const char *pcMode) {
     FRESULT fr = f_open(&cookie_p->file, pathname, mode);
     if (FR_OK != fr) {
         DBG_PRINTF("f_open error: %s\n", FRESULT_str(fr));
-        free( cookie_p);
+        cookie_free(cookie_p);
         return NULL;
     }
     cookie_io_functions_t iofs = {cookie_read_function, cookie_write_function,
                                   cookie_seek_function, cookie_close_function};
+    cookie_p->buf = NULL;
+    cookie_p->buf_size = 0;
 
     /* create the stream */
     FILE *file = fopencookie(cookie_p, pcMode, iofs);
-    if (!file) cookie_close_function(cookie_p);
+    if (!file) {
+        cookie_close_function(cookie_p);
+        return NULL;
+    }
+#if FILE_STREAM_BUF_SIZE
+    /* Give it a buffer of whole sectors, up to a cluster, for whole-sector
+    transfers from word aligned memory */
+    FATFS *fs_p = cookie_p->file.obj.fs;
+    size_t ss = SECTOR_SIZE(fs_p);
+    size_t size = FILE_STREAM_BUF_SIZE;
+    if (size > fs_p->csize * ss) size = fs_p->csize * ss;
+    size -= size % ss;
+    if (!size) size = ss;
+    cookie_p->buf = buf_alloc(size);
+    if (cookie_p->buf) {
+        if (setvbuf(file, cookie_p->buf, _IOFBF, size)) {
+            buf_free(cookie_p->buf);
+            cookie_p->buf = NULL;
+        } else {
+            cookie_p->buf_size = size;
+        }
+    }  // else keep the C library's buffering
+#endif
     return (file);
 }
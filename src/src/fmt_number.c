@@ -0,0 +1,154 @@
+/* fmt_number.c
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+#include <math.h>
+#include <string.h>
+//
+#include "fmt_number.h"
+
+static const char digit_pairs[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const uint64_t pow10_tbl[FMT_FIXED_MAX_PREC + 1] = {
+    1ULL,
+    10ULL,
+    100ULL,
+    1000ULL,
+    10000ULL,
+    100000ULL,
+    1000000ULL,
+    10000000ULL,
+    100000000ULL,
+    1000000000ULL,
+    10000000000ULL,
+    100000000000ULL,
+    1000000000000ULL,
+    10000000000000ULL,
+    100000000000000ULL,
+    1000000000000000ULL,
+    10000000000000000ULL,
+    100000000000000000ULL,
+    1000000000000000000ULL,
+    10000000000000000000ULL};
+
+/* Write exactly n digits of v, zero padded, ending at end (n <= 10) */
+static void put_digits32(char *end, uint32_t v, unsigned n) {
+    for (; n >= 2; n -= 2) {
+        uint32_t q = v / 100;
+        end -= 2;
+        memcpy(end, &digit_pairs[2 * (v - 100 * q)], 2);
+        v = q;
+    }
+    if (n) *--end = (char)('0' + v);
+}
+
+/* Write exactly n digits of v, zero padded, ending at end */
+static void put_digits64(char *end, uint64_t v, unsigned n) {
+    while (n > 9) {  // One 64-bit division per eight digits
+        uint64_t q = v / 100000000;
+        put_digits32(end, (uint32_t)(v - q * 100000000), 8);
+        end -= 8;
+        n -= 8;
+        v = q;
+    }
+    put_digits32(end, (uint32_t)v, n);
+}
+
+unsigned fmt_len_u32(uint32_t v) {
+    unsigned n = 1;
+    while (n < 10 && v >= pow10_tbl[n]) ++n;
+    return n;
+}
+
+unsigned fmt_len_u64(uint64_t v) {
+    if (v <= UINT32_MAX) return fmt_len_u32((uint32_t)v);
+    unsigned n = 10;
+    while (n < 20 && v >= pow10_tbl[n]) ++n;
+    return n;
+}
+
+char *fmt_u32(char *first, char *last, uint32_t v) {
+    unsigned n = fmt_len_u32(v);
+    if ((size_t)(last - first) < n) return NULL;
+    put_digits32(first + n, v, n);
+    return first + n;
+}
+
+char *fmt_u64(char *first, char *last, uint64_t v) {
+    unsigned n = fmt_len_u64(v);
+    if ((size_t)(last - first) < n) return NULL;
+    put_digits64(first + n, v, n);
+    return first + n;
+}
+
+char *fmt_i32(char *first, char *last, int32_t v) {
+    if (v >= 0) return fmt_u32(first, last, (uint32_t)v);
+    if (first == last) return NULL;
+    *first++ = '-';
+    return fmt_u32(first, last, 0 - (uint32_t)v);
+}
+
+char *fmt_i64(char *first, char *last, int64_t v) {
+    if (v >= 0) return fmt_u64(first, last, (uint64_t)v);
+    if (first == last) return NULL;
+    *first++ = '-';
+    return fmt_u64(first, last, 0 - (uint64_t)v);
+}
+
+char *fmt_fixed(char *first, char *last, double v, unsigned prec) {
+    if (prec > FMT_FIXED_MAX_PREC || v != v) return NULL;  // NaN?
+    int neg = signbit(v) != 0;  // -0.0 too, as printf
+    if (neg) v = -v;
+    /* Scale once; the rest is integer arithmetic */
+    double p = (double)pow10_tbl[prec];  // Exact
+    double w = v * p;
+    if (!(w < 9007199254740992.0)) return NULL;  // Beyond the 53-bit mantissa (or infinite)?
+    uint64_t s = (uint64_t)w;
+    double f = w - (double)s;  // Exact
+    /* Round to nearest. Only when the rounded product is exactly halfway can
+    the rounding error of the product change the result: then its sign, from
+    fma, decides, and a true tie goes to even like printf. */
+    if (f > 0.5) {
+        ++s;
+    } else if (f == 0.5) {
+        double err = fma(v, p, -w);
+        if (err > 0 || (err == 0 && (s & 1))) ++s;
+    }
+    uint64_t ip = s / pow10_tbl[prec];
+    uint64_t fp = s - ip * pow10_tbl[prec];
+    if (neg) {
+        if (first == last) return NULL;
+        *first++ = '-';
+    }
+    first = fmt_u64(first, last, ip);
+    if (!first) return NULL;
+    if (prec) {
+        if ((size_t)(last - first) < prec + 1) return NULL;
+        *first++ = '.';
+        put_digits64(first + prec, fp, prec);
+        first += prec;
+    }
+    return first;
+}
+
+/* [] END OF FILE */
@@ -24,6 +24,7 @@ specific language governing permissions and limitations under the License.
 #include "hw_config.h"
 #include "my_debug.h"
 #include "sd_card.h"
+#include "sd_io_service.h"
 //
 #include "diskio.h" /* Declarations of disk functions */
 
@@ -60,6 +61,10 @@ DSTATUS disk_initialize(
     DSTATUS ds = disk_status(pdrv);
     if (STA_NODISK & ds) 
         return ds;
+    if (sd_io_service_offload()) {
+        sd_io_transfer(sd_card_p, SD_IO_INIT, NULL, 0, 0);
+        return sd_card_p->state.m_Status;
+    }
     // See http://elm-chan.org/fsw/ff/doc/dstat.html
     return sd_card_p->init(sd_card_p);  
 }
@@ -99,7 +104,11 @@ DRESULT disk_read(BYTE pdrv,  /* Physical drive number to identify the drive */
     TRACE_PRINTF(">>> %s\n", __FUNCTION__);
     sd_card_t *sd_card_p = sd_get_by_num(pdrv);
     if (!sd_card_p) return RES_PARERR;
-    int rc = sd_card_p->read_blocks(sd_card_p, buff, sector, count);
+    int rc;
+    if (sd_io_service_offload())
+        rc = sd_io_transfer(sd_card_p, SD_IO_READ, buff, sector, count);
+    else
+        rc = sd_card_p->read_blocks(sd_card_p, buff, sector, count);
     return sdrc2dresult(rc);
 }
 
@@ -117,7 +126,11 @@ DRESULT disk_write(BYTE pdrv, /* Physical drive number to identify the drive */
     TRACE_PRINTF(">>> %s\n", __FUNCTION__);
     sd_card_t *sd_card_p = sd_get_by_num(pdrv);
     if (!sd_card_p) return RES_PARERR;
-    int rc = sd_card_p->write_blocks(sd_card_p, buff, sector, count);
+    int rc;
+    if (sd_io_service_offload())
+        rc = sd_io_transfer(sd_card_p, SD_IO_WRITE, (BYTE *)buff, sector, count);
+    else
+        rc = sd_card_p->write_blocks(sd_card_p, buff, sector, count);
     return sdrc2dresult(rc);
 }
 
@@ -142,8 +155,7 @@ DRESULT disk_ioctl(BYTE pdrv, /* Physical drive number (0..) */
                                   // function to determine the size of
                                   // volume/partition to be created. It is
                                   // required when FF_USE_MKFS == 1.
-            static LBA_t n;
-            n = sd_card_p->get_num_sectors(sd_card_p);
+            LBA_t n = sd_card_p->get_num_sectors(sd_card_p);
             *(LBA_t *)buff = n;
             if (!n) return RES_ERROR;
             return RES_OK;
@@ -157,12 +169,31 @@ DRESULT disk_ioctl(BYTE pdrv, /* Physical drive number (0..) */
                                 // f_mkfs function and it attempts to align data
                                 // area on the erase block boundary. It is
                                 // required when FF_USE_MKFS == 1.
-            static DWORD bs = 1;
-            *(DWORD *)buff = bs;
+            *(DWORD *)buff = 1;
+            return RES_OK;
+        }
+        case GET_ALLOC_UNIT: {  // Retrieves the SD card's Allocation Unit in
+                                // unit of sector into the DWORD variable
+                                // pointed by buff, or 1 if it is unknown.
+                                // FF_PREALLOC_CLUSTERS uses it to align the
+                                // areas it reserves for growing files.
+            /* Report the SD card's Allocation Unit when it is known. The
+            driver reads it when it initializes the card, so this can be
+            called in the middle of a write. */
+            DWORD n = 1;
+            size_t au_size_bytes;
+            if (sd_allocation_unit(sd_card_p, &au_size_bytes) && au_size_bytes) {
+                n = au_size_bytes / sd_block_size;
+                if (n > 32768 || (n & (n - 1))) n = 1;  // 12 and 24 MB AUs are not a power of 2
+            }
+            *(DWORD *)buff = n;
             return RES_OK;
         }
         case CTRL_SYNC:
-            sd_card_p->sync(sd_card_p);
+            if (sd_io_service_offload())
+                sd_io_transfer(sd_card_p, SD_IO_SYNC, NULL, 0, 0);
+            else
+                sd_card_p->sync(sd_card_p);
             return RES_OK;
         default:
             return RES_PARERR;
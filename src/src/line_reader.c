@@ -0,0 +1,127 @@
+/* line_reader.c
+Copyright 2026 Carl John Kugler III
+
+Licensed under the Apache License, Version 2.0 (the License); you may not use
+this file except in compliance with the License. You may obtain a copy of the
+License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software distributed
+under the License is distributed on an AS IS BASIS, WITHOUT WARRANTIES OR
+CONDITIONS OF ANY KIND, either express or implied. See the License for the
+specific language governing permissions and limitations under the License.
+*/
+
+#include <stdint.h>
+#include <string.h>
+//
+#include "line_reader.h"
+
+#if FF_MAX_SS == FF_MIN_SS
+#  define SECTOR_SIZE(fs) ((UINT)FF_MAX_SS)
+#else
+#  define SECTOR_SIZE(fs) ((fs)->ssize)
+#endif
+
+const char *line_find(const char *first, const char *last, char c) {
+    // Bytes up to a word boundary
+    while (first < last && ((uintptr_t)first & 3)) {
+        if (*first == c) return first;
+        ++first;
+    }
+    /* A word at a time: the bytes of x are zero where the word matches c,
+    and (x - 0x01010101) & ~x has the high bit of some byte set just when a
+    byte of x is zero */
+    uint32_t pattern = 0x01010101u * (uint8_t)c;
+    for (; last - first >= 4; first += 4) {
+        uint32_t x;
+        memcpy(&x, first, 4);  // An aligned load
+        x ^= pattern;
+        if ((x - 0x01010101u) & ~x & 0x80808080u) break;
+    }
+    for (; first < last; ++first)
+        if (*first == c) return first;
+    return NULL;
+}
+
+void line_reader_init(line_reader_t *lr, FIL *fp, void *buf, size_t size) {
+    memset(lr, 0, sizeof *lr);
+    lr->fp = fp;
+    lr->buf = buf;
+    lr->size = size;
+}
+
+// Move the unreturned bytes to the front of the buffer and read more after them
+static void refill(line_reader_t *lr) {
+    size_t n = lr->end - lr->pos;
+    memmove(lr->buf, lr->buf + lr->pos, n);
+    lr->pos = 0;
+    lr->end = n;
+    // Keep a byte for the terminating null, and end the read on a sector boundary
+    n = lr->size - 1 - lr->end;
+    UINT ss = SECTOR_SIZE(lr->fp->obj.fs);
+    size_t over = (size_t)((f_tell(lr->fp) + n) % ss);
+    if (over < n) n -= over;
+    UINT br = 0;
+    lr->fr = f_read(lr->fp, lr->buf + lr->end, (UINT)n, &br);
+    if (FR_OK == lr->fr && br < n) lr->eof = true;
+    lr->end += br;
+}
+
+/* Return the line [pos, stop), terminated in place, and move pos to next.
+next > stop when the line ends with delim. */
+static char *take(line_reader_t *lr, size_t stop, size_t next, char delim, size_t *len) {
+    char *line = lr->buf + lr->pos;
+    size_t n = stop - lr->pos;
+    if (next > stop && '\n' == delim && n && '\r' == line[n - 1]) --n;
+    line[n] = 0;
+    lr->pos = next;
+    lr->piece = false;
+    if (len) *len = n;
+    return line;
+}
+
+char *line_reader_getline(line_reader_t *lr, char delim, size_t *len) {
+    if (lr->size < 2) return NULL;
+    size_t scanned = lr->pos;  // Where to resume the search for delim
+    for (;;) {
+        const char *d = line_find(lr->buf + scanned, lr->buf + lr->end, delim);
+        if (d) {
+            size_t stop = d - lr->buf;
+            if (lr->piece && stop == lr->pos) {
+                // The delim ending a long line whose last piece has been returned
+                lr->piece = false;
+                scanned = ++lr->pos;
+                continue;
+            }
+            return take(lr, stop, stop + 1, delim, len);
+        }
+        if (lr->eof || FR_OK != lr->fr) {
+            if (lr->pos == lr->end) return NULL;
+            return take(lr, lr->end, lr->end, delim, len);  // Last line, without delim
+        }
+        if (0 == lr->pos && lr->end == lr->size - 1) {
+            char *line = take(lr, lr->end, lr->end, delim, len);  // A piece of a long line
+            lr->piece = true;
+            return line;
+        }
+        scanned = lr->end - lr->pos;
+        refill(lr);
+    }
+}
+
+size_t line_split(char *line, size_t len, char delim, char *fields[], size_t max) {
+    char *end = line + len;
+    size_t n = 0;
+    while (n < max) {
+        fields[n++] = line;
+        if (n == max) break;
+        char *d = (char *)line_find(line, end, delim);
+        if (!d) break;
+        *d = 0;
+        line = d + 1;
+    }
+    return n;
+}
+
+/* [] END OF FILE */